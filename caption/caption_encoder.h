@@ -0,0 +1,91 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#ifndef LIBCAPTION_CAPTION_ENCODER_H
+#define LIBCAPTION_CAPTION_ENCODER_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "caption.h"
+#include "cea708.h"
+#include "cmdlist.h"
+#include "utf8.h"
+
+#define CAPTION_ENCODER_DEFAULT_CAPACITY 32
+
+typedef enum {
+    caption_encoder_popon = 0,
+    caption_encoder_rollup = 1,
+} caption_encoder_mode_t;
+
+typedef struct {
+    uint64_t hash; //< hash of text, mode and channel, 0 if the entry is unused
+    uint64_t used; //< value of the encoder clock when the entry was last returned
+    int clear; //< the entry clears the screen, text is unused
+    utf8_char_t* text;
+    size_t text_capacity;
+    caption_encoder_mode_t mode;
+    int channel;
+    uint8_t* data; //< rendered SEI NAL unit
+    size_t size;
+    size_t data_capacity;
+} caption_encoder_entry_t;
+
+// Renders captions from text to SEI NAL units, keeping the most recently used results so a
+// caption that repeats is copied instead of encoded again. All scratch state lives here and
+// the buffers only ever grow, so once warmed up a render does not touch the heap
+typedef struct {
+    size_t capacity;
+    uint64_t clock;
+    caption_encoder_entry_t* entries;
+    cc_data_cmdlist_t cmdlist; //< scratch list, kept between renders
+    caption_frame_t frame; //< scratch frame for pop-on captions
+    cea708_t cea708; //< scratch user data, rendered straight into an entry
+} caption_encoder_t;
+
+/*! \brief Initializes a caption_encoder_t with an empty cache
+    \param enc Pointer to prealocated caption_encoder_t object
+    \param capacity Number of rendered captions to keep, CAPTION_ENCODER_DEFAULT_CAPACITY if 0
+*/
+void caption_encoder_init(caption_encoder_t* enc, size_t capacity);
+/*! \brief Releases the cache of a caption_encoder_t
+    \param enc A pointer to an initialized caption_encoder_t object
+*/
+void caption_encoder_free(caption_encoder_t* enc);
+/*! \brief Renders text to an SEI NAL unit carrying 608 captions
+    \param enc A pointer to an initialized caption_encoder_t object
+    \param text UTF-8 caption text, or NULL to clear the screen
+    \param mode caption_encoder_popon for a pop-on caption, caption_encoder_rollup for roll-up
+    \param channel 608 data channel, 0 for CC1, 1 for CC2
+    \param size Set to the size of the returned NAL unit
+
+    Returns NULL on error. The data belongs to enc and is valid until the next call.
+    No sei_t is built, the cc_data is rendered directly into the cached entry
+*/
+const uint8_t* caption_encoder_render(caption_encoder_t* enc, const utf8_char_t* text, caption_encoder_mode_t mode, int channel, size_t* size);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -29,6 +29,7 @@ extern "C" {
 
 #include "caption.h"
 #include "cea708_types.h"
+#include "checkpoint.h"
 #include "utf8.h"
 #include "xds.h"
 
@@ -41,16 +42,51 @@ typedef struct {
 
 typedef struct {
     caption_frame_cell_t cell[SCREEN_ROWS][SCREEN_COLS];
+    // Maintained incrementally on every write, an empty buffer hashes to 0
+    uint64_t row_hash[SCREEN_ROWS];
+    uint64_t hash;
 } caption_frame_buffer_t;
 
+// Up to 4 bytes per cell plus null term
+#define CAPTION_FRAME_ROW_BYTES (4 * SCREEN_COLS + 1)
+#define CAPTION_FRAME_ALL_ROWS ((1 << SCREEN_ROWS) - 1)
+
+// Text of the front buffer, cached per row. Rows are only re-rendered when dirty
+typedef struct {
+    uint16_t dirty; //< bitmap of front buffer rows changed since the last render
+    uint8_t size[SCREEN_ROWS]; //< bytes of text in each row, 0 for a blank row
+    utf8_char_t data[SCREEN_ROWS][CAPTION_FRAME_ROW_BYTES];
+} caption_frame_text_t;
+
 typedef struct {
     unsigned int uln : 1; //< underline
     unsigned int sty : 3; //< style
     unsigned int rup : 2; //< roll-up line count minus 1
+    unsigned int txt : 1; //< text service, honors text restart and resume text display
     int8_t row, col;
     uint16_t cc_data;
 } caption_frame_state_t;
 
+// Policies are combined as a bitmask, see caption_frame_set_coalesce()
+typedef enum {
+    caption_frame_coalesce_none = 0,
+    caption_frame_coalesce_interval = 1, //< hold READY until the interval has passed since the last one
+    caption_frame_coalesce_row = 2, //< hold READY until the cursor leaves the row
+    caption_frame_coalesce_content = 4, //< drop READY if caption_frame_hash() did not change
+} caption_frame_coalesce_policy_t;
+
+typedef struct {
+    unsigned int policy : 3;
+    unsigned int pending : 1; //< a READY is being held back
+    unsigned int row_done : 1; //< cursor left the row while decoding the current word
+    unsigned int display : 1; //< display was replaced or erased while decoding the current word
+    double interval; //< minimum seconds of media time between READY events
+    double last; //< timestamp of the last READY released, -1 for none
+    uint64_t hash; //< content hash of the last READY released
+} caption_frame_coalesce_t;
+
+struct _caption_publisher_t;
+
 // timestamp and duration are in seconds
 typedef struct {
     double timestamp;
@@ -59,9 +95,41 @@ typedef struct {
     caption_frame_buffer_t front;
     caption_frame_buffer_t back;
     caption_frame_buffer_t* write;
+    caption_frame_text_t text;
+    caption_frame_coalesce_t coalesce;
+    struct _caption_publisher_t* publisher; //< receives a snapshot whenever the frame is READY, may be NULL
     libcaption_stauts_t status;
 } caption_frame_t;
 
+// CC3, CC4, TEXT3 and TEXT4 are carried in field 2
+typedef enum {
+    caption_channel_cc1 = 0,
+    caption_channel_cc2 = 1,
+    caption_channel_cc3 = 2,
+    caption_channel_cc4 = 3,
+    caption_channel_text1 = 4,
+    caption_channel_text2 = 5,
+    caption_channel_text3 = 6,
+    caption_channel_text4 = 7,
+    caption_channel_xds = 8, //< only used as a bit in caption_decoder_t.ready
+} caption_channel_t;
+
+#define CAPTION_CHANNEL_COUNT 8
+
+typedef struct {
+    unsigned int chan : 1; //< data channel selected by the last channel specific code
+    unsigned int text : 2; //< bitmap of data channels in text mode
+    unsigned int xds : 1; //< inside an XDS packet that has not been interrupted by a caption code
+    int8_t last; //< channel that received the previous word, -1 for none
+} caption_decoder_field_t;
+
+typedef struct {
+    caption_frame_t frame[CAPTION_CHANNEL_COUNT];
+    caption_decoder_field_t field[2];
+    xds_t xds;
+    uint16_t ready; //< bitmap of channels that returned READY since the last caption_decoder_reset_ready
+} caption_decoder_t;
+
 /*!
     \brief Initializes an allocated caption_frame_t instance
     \param frame Pointer to prealocated caption_frame_t object
@@ -84,13 +152,21 @@ static inline int caption_frame_rollup(caption_frame_t* frame) { return _caption
     \param
 */
 static inline double caption_frame_timestamp(caption_frame_t* frame) { return frame->timestamp; }
+/*! \brief Hash of the displayed (front buffer) content, including style and underline
+    \param frame A pointer to an allocted and initialized caption_frame_t object
+
+    Kept up to date as characters are written, buffers are cleared and rows roll up, so
+    comparing hashes detects duplicate updates without rendering text. A blank screen hashes to 0
+*/
+static inline uint64_t caption_frame_hash(caption_frame_t* frame) { return frame->front.hash; }
 /*! \brief Writes a single charcter to a caption_frame_t object
     \param frame A pointer to an allocted and initialized caption_frame_t object
     \param row Row position to write charcter, must be between 0 and SCREEN_ROWS-1
     \param col Column position to write charcter, must be between 0 and SCREEN_ROWS-1
     \param style Style to apply to charcter
     \param underline Set underline attribute, 0 = off any other value = on
-    \param c pointer to a single valid utf8 charcter. Bytes are automatically determined, and a NULL terminator is not required
+    \param c pointer to a single valid utf8 charcter. Bytes are automatically determined, and a NULL terminator is not required.
+    EIA608_CHAR_NULL clears the cell
 */
 int caption_frame_write_char(caption_frame_t* frame, int row, int col, eia608_style_t style, int underline, const utf8_char_t* c);
 /*! \brief
@@ -101,13 +177,85 @@ const utf8_char_t* caption_frame_read_char(caption_frame_t* frame, int row, int
     \param
 */
 libcaption_stauts_t caption_frame_decode(caption_frame_t* frame, uint16_t cc_data, double timestamp);
+/*! \brief Decodes an array of cc_data words that share a timestamp
+    \param frame A pointer to an allocted and initialized caption_frame_t object
+    \param cc_data Words from the cc_data stream, with parity
+    \param count Number of words in cc_data
+    \param timestamp Presentation time in seconds
+    \param consumed Set to the number of words decoded, may be NULL
+
+    Stops after the first word that returns LIBCAPTION_READY or LIBCAPTION_ERROR, call again with
+    the remaining words once the frame has been handled. Runs of padding are skipped.
+*/
+libcaption_stauts_t caption_frame_decode_many(caption_frame_t* frame, const uint16_t* cc_data, size_t count, double timestamp, size_t* consumed);
+/*! \brief Rate limits the READY events returned by caption_frame_decode
+    \param frame A pointer to an allocted and initialized caption_frame_t object
+    \param policy Bitmask of caption_frame_coalesce_policy_t values, caption_frame_coalesce_none to disable
+    \param interval Minimum seconds of media time between READY events for caption_frame_coalesce_interval
+
+    A held READY is released once any of the enabled interval or row conditions is met, so only the
+    final state of each window is reported. End of caption and erase display memory always release.
+    Must be called after caption_frame_init, which resets the policy.
+*/
+void caption_frame_set_coalesce(caption_frame_t* frame, int policy, double interval);
+/*! \brief Publishes a snapshot of the displayed content every time the frame is READY
+    \param frame A pointer to an allocted and initialized caption_frame_t object
+    \param publisher Pointer to an initialized caption_publisher_t, or NULL to stop publishing
+
+    Must be called after caption_frame_init, which clears the publisher. See caption_publisher.h
+*/
+void caption_frame_set_publisher(caption_frame_t* frame, struct _caption_publisher_t* publisher);
+/*! \brief Releases a READY held back by the coalescing policy
+    \param frame A pointer to an allocted and initialized caption_frame_t object
+
+    Returns LIBCAPTION_READY if an update was pending, call at end of stream
+*/
+libcaption_stauts_t caption_frame_flush(caption_frame_t* frame);
+/*! \brief Initializes a caption_decoder_t, every channel frame is initialized with caption_frame_init
+    \param decoder Pointer to prealocated caption_decoder_t object
+*/
+void caption_decoder_init(caption_decoder_t* decoder);
+/*! \brief Routes a single cc_data word to the channel it belongs to
+    \param decoder A pointer to an allocted and initialized caption_decoder_t object
+    \param field 0 for field 1 (CC1, CC2, TEXT1, TEXT2), 1 for field 2 (CC3, CC4, TEXT3, TEXT4 and XDS)
+    \param cc_data Word from the cc_data stream, with parity
+    \param timestamp Presentation time in seconds
+
+    Channel frames keep their own state, including duplicate control code suppression and any
+    coalescing policy set with caption_frame_set_coalesce. Returns LIBCAPTION_READY when the
+    channel that received the word is ready, the channel bit is also set in decoder->ready
+*/
+libcaption_stauts_t caption_decoder_decode(caption_decoder_t* decoder, int field, uint16_t cc_data, double timestamp);
 /*! \brief
     \param
 */
-int caption_frame_from_text(caption_frame_t* frame, const utf8_char_t* data);
+static inline caption_frame_t* caption_decoder_frame(caption_decoder_t* decoder, caption_channel_t chan) { return (0 <= chan && CAPTION_CHANNEL_COUNT > chan) ? &decoder->frame[chan] : 0; }
 /*! \brief
     \param
 */
+static inline int caption_decoder_ready(caption_decoder_t* decoder, caption_channel_t chan) { return (decoder->ready >> chan) & 1; }
+/*! \brief
+    \param
+*/
+static inline void caption_decoder_reset_ready(caption_decoder_t* decoder) { decoder->ready = 0; }
+/*! \brief Saves or restores the complete state of a caption_frame_t
+    \param cp A checkpoint_t initialized with checkpoint_init_save or checkpoint_init_load
+    \param frame A pointer to an allocted and initialized caption_frame_t object
+
+    Only non-empty cells are stored. On load every row is marked dirty and the content hashes are
+    recomputed, the frame is only valid if LIBCAPTION_OK is returned
+*/
+libcaption_stauts_t caption_frame_checkpoint(checkpoint_t* cp, caption_frame_t* frame);
+/*! \brief
+    \param
+*/
+int caption_frame_from_text(caption_frame_t* frame, const utf8_char_t* data);
+/*! \brief Renders the front buffer as text, one line per non-blank row
+    \param frame A pointer to an allocted and initialized caption_frame_t object
+    \param data Destination buffer, must be at least CAPTION_FRAME_TEXT_BYTES bytes
+
+    Only rows modified since the previous call are re-rendered, the rest are copied from the row cache
+*/
 #define CAPTION_FRAME_TEXT_BYTES (4 * ((SCREEN_COLS + 2) * SCREEN_ROWS) + 1)
 size_t caption_frame_to_text(caption_frame_t* frame, utf8_char_t* data);
 /*! \brief
@@ -0,0 +1,87 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#ifndef LIBCAPTION_CAPTION_PUBLISHER_H
+#define LIBCAPTION_CAPTION_PUBLISHER_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "caption_frame.h"
+
+// Displayed content of a caption_frame_t at the time it was READY
+typedef struct {
+    uint64_t sequence; //< 1 for the first snapshot published, incremented by one for every snapshot
+    double timestamp;
+    uint64_t hash; //< caption_frame_hash() of the frame
+    caption_frame_buffer_t screen; //< copy of the front buffer, including style and underline
+    size_t size;
+    utf8_char_t text[CAPTION_FRAME_TEXT_BYTES]; //< caption_frame_to_text() of the frame
+} caption_snapshot_t;
+
+// Number of snapshots kept, a reader only retries if this many are published while it copies one
+#define CAPTION_PUBLISHER_SLOTS 4
+
+typedef struct {
+    uint64_t seq; //< odd while the slot is being written
+    caption_snapshot_t snapshot;
+} caption_publisher_slot_t;
+
+// One thread publishes, any number of threads read. Readers never block the publisher
+typedef struct _caption_publisher_t {
+    uint64_t latest; //< sequence of the newest complete snapshot, 0 for none
+    caption_publisher_slot_t slot[CAPTION_PUBLISHER_SLOTS];
+} caption_publisher_t;
+
+/*! \brief Initializes a caption_publisher_t
+    \param pub Pointer to prealocated caption_publisher_t object
+
+    Must not be called while other threads read from pub
+*/
+void caption_publisher_init(caption_publisher_t* pub);
+/*! \brief Publishes the displayed content of a frame
+    \param pub A pointer to an initialized caption_publisher_t object
+    \param frame A pointer to an allocted and initialized caption_frame_t object
+
+    Called by caption_frame_decode when it returns LIBCAPTION_READY if the frame has a publisher set with
+    caption_frame_set_publisher. Only one thread may publish to a caption_publisher_t
+*/
+void caption_publisher_publish(caption_publisher_t* pub, caption_frame_t* frame);
+/*! \brief Copies the newest snapshot
+    \param pub A pointer to an initialized caption_publisher_t object
+    \param snapshot Destination for the snapshot
+
+    Returns 1 if a snapshot was copied, 0 if nothing has been published yet. Safe to call from any thread
+*/
+int caption_publisher_read(caption_publisher_t* pub, caption_snapshot_t* snapshot);
+/*! \brief Sequence of the newest snapshot, 0 if nothing has been published
+    \param pub A pointer to an initialized caption_publisher_t object
+
+    Cheap enough to poll, call caption_publisher_read only once it changes
+*/
+uint64_t caption_publisher_sequence(caption_publisher_t* pub);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,78 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#ifndef LIBCAPTION_CC_SCHEDULER_H
+#define LIBCAPTION_CC_SCHEDULER_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "cmdlist.h"
+
+// NTSC field pairs per second, each field carries at most one 608 cc_data pair
+#define CC_SCHEDULER_608_RATE (30000.0 / 1001.0)
+
+// Splits the cc_data bandwidth of a video stream between 608 field 1, 608 field 2 and DTVCC.
+// Producers append to the queues, cc_scheduler_frame drains them once per video frame
+typedef struct {
+    uint8_t cc_count; //< cc_data slots in every frame
+    double rate; //< 608 pairs each field may send per frame
+    double credit[2]; //< 608 pairs each field may still send
+    cc_data_cmdlist_t field[2]; //< 608 queues for field 1 and field 2, highest priority first
+    cc_data_cmdlist_t dtvcc; //< DTVCC packet queue, uses the slots 608 leaves over
+} cc_scheduler_t;
+
+/*! \brief Number of cc_data slots per frame for a frame rate
+    \param fps Video frame rate
+
+    The 9600 bit/s caption channel carries 600 cc_data entries a second, e.g. 20 per frame at 29.97
+    and 10 per frame at 59.94. Limited to the 30 entries a cea708_t accepts
+*/
+int cc_scheduler_cc_count(double fps);
+/*! \brief Initializes a cc_scheduler_t with empty queues
+    \param sched Pointer to prealocated cc_scheduler_t object
+    \param fps Video frame rate
+*/
+void cc_scheduler_init(cc_scheduler_t* sched, double fps);
+/*! \brief Releases the queues of a cc_scheduler_t
+    \param sched A pointer to an initialized cc_scheduler_t object
+*/
+void cc_scheduler_free(cc_scheduler_t* sched);
+/*! \brief Fills a cea708_t with the cc_data of the next video frame
+    \param sched A pointer to an initialized cc_scheduler_t object
+    \param cea708 A pointer to an initialized cea708_t object with no cc_data
+
+    608 pairs are sent at the line 21 rate, field 1 before field 2. DTVCC fills the remaining slots
+    and unused slots are padded with invalid entries, so every frame carries exactly cc_count entries.
+    Returns LIBCAPTION_ERROR if cea708 already holds cc_data
+*/
+libcaption_stauts_t cc_scheduler_frame(cc_scheduler_t* sched, cea708_t* cea708);
+/*! \brief Number of cc_data entries waiting in all queues
+    \param sched A pointer to an initialized cc_scheduler_t object
+*/
+static inline size_t cc_scheduler_pending(const cc_scheduler_t* sched) { return sched->field[0].length + sched->field[1].length + sched->dtvcc.length; }
+
+#ifdef __cplusplus
+}
+#endif
+#endif
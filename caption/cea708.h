@@ -71,6 +71,12 @@ libcaption_stauts_t cea708_parse_h262(const uint8_t* data, size_t size, cea708_t
     \param
 */
 libcaption_stauts_t cea708_to_caption_frame(caption_frame_t* frame, cea708_t* cea708, dtvcc_packet_t* dtvcc, uint8_t* dtvcc_pos);
+/*! \brief Decodes field 1 and field 2 cc_data into every 608 channel of a caption_decoder_t
+    \param
+
+    Check decoder->ready to find out which channels have changed
+*/
+libcaption_stauts_t cea708_to_caption_decoder(caption_decoder_t* decoder, cea708_t* cea708, dtvcc_packet_t* dtvcc, uint8_t* dtvcc_pos);
 /*! \brief
     \param
 */
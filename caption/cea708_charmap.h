@@ -22,6 +22,12 @@ extern "C" {
  */
 uint16_t cea708_from_utf8_1(const utf8_char_t* c);
 
+// Generated by from_utf8.py. cea708_from_codepoint_block[codepoint >> 6] selects a block of
+// 64 character codes in cea708_from_codepoint. The first 128 entries are the ASCII range.
+#define CEA708_FROM_CODEPOINT_LIMIT 0x2700
+extern const uint8_t cea708_from_codepoint_block[CEA708_FROM_CODEPOINT_LIMIT >> 6];
+extern const uint16_t cea708_from_codepoint[];
+
 #define CEA708_CHAR_SPACE "\x20"
 #define CEA708_CHAR_EXCLAMATION_MARK "\x21"
 #define CEA708_CHAR_QUOTATION_MARK "\x22"
@@ -67,6 +67,7 @@ typedef struct {
     uint8_t directv_user_data_length;
     user_data_t user_data;
     double timestamp;
+    int fixed_count; // render exactly cc_count entries instead of padding to a multiple of 5
 } cea708_t;
 
 typedef struct {
@@ -201,7 +202,7 @@ typedef enum {
     cea708_anchor_point_bottom = 7,
 } cea708_anchor_point_t;
 
-#pragma pack(1)
+#pragma pack(push, 1)
 typedef struct {
     unsigned int priority : 3;
     unsigned int column_lock : 1;
@@ -230,7 +231,6 @@ typedef struct {
     unsigned int _padding3 : 2;
 } cea708_define_window_t;
 
-#pragma pack(1)
 typedef struct {
     unsigned int row : 4;
     unsigned int _padding0 : 4;
@@ -238,6 +238,7 @@ typedef struct {
     unsigned int column : 6;
     unsigned int _padding1 : 2;
 } cea708_set_pen_location_t;
+#pragma pack(pop)
 
 #ifdef __cplusplus
 }
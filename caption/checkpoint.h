@@ -0,0 +1,128 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#ifndef LIBCAPTION_CHECKPOINT_H
+#define LIBCAPTION_CHECKPOINT_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "caption.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// Incremented whenever the layout of a section changes
+#define CHECKPOINT_VERSION 1
+#define CHECKPOINT_HEADER_SIZE 5
+
+// Sections may appear in any order, unknown sections are skipped on load
+typedef enum {
+    checkpoint_section_end = 0,
+    checkpoint_section_caption_frame = 1,
+    checkpoint_section_mpeg_bitstream = 2,
+    checkpoint_section_dtvcc_packet = 3,
+} checkpoint_section_t;
+
+// All values are stored little endian. The same functions are used to save and load, so the two can not drift apart
+typedef struct {
+    uint8_t* data; //< NULL when saving to only measure the required size
+    size_t size;
+    size_t pos;
+    int load;
+    libcaption_stauts_t status; //< LIBCAPTION_ERROR once the buffer overflows or invalid data is found
+} checkpoint_t;
+
+/*! \brief Prepares a checkpoint_t for writing
+    \param cp Pointer to a checkpoint_t
+    \param data Destination buffer, or NULL to measure
+    \param size Size of the destination buffer
+*/
+void checkpoint_init_save(checkpoint_t* cp, uint8_t* data, size_t size);
+/*! \brief Prepares a checkpoint_t for reading
+    \param cp Pointer to a checkpoint_t
+    \param data Checkpoint data. It is never modified
+    \param size Size of the checkpoint data
+*/
+void checkpoint_init_load(checkpoint_t* cp, const uint8_t* data, size_t size);
+/*! \brief
+    \param
+*/
+static inline int checkpoint_loading(checkpoint_t* cp) { return cp->load; }
+/*! \brief Marks the checkpoint invalid
+    \param
+
+    Used by the section functions when loaded values are out of range
+*/
+static inline libcaption_stauts_t checkpoint_fail(checkpoint_t* cp) { return cp->status = LIBCAPTION_ERROR; }
+/*! \brief
+    \param
+*/
+void checkpoint_bytes(checkpoint_t* cp, void* data, size_t size);
+/*! \brief
+    \param
+*/
+void checkpoint_u8(checkpoint_t* cp, uint8_t* value);
+/*! \brief
+    \param
+*/
+void checkpoint_u16(checkpoint_t* cp, uint16_t* value);
+/*! \brief
+    \param
+*/
+void checkpoint_u32(checkpoint_t* cp, uint32_t* value);
+/*! \brief
+    \param
+*/
+void checkpoint_u64(checkpoint_t* cp, uint64_t* value);
+/*! \brief
+    \param
+*/
+void checkpoint_double(checkpoint_t* cp, double* value);
+/*! \brief Writes or verifies the checkpoint magic and version
+    \param
+*/
+libcaption_stauts_t checkpoint_header(checkpoint_t* cp);
+/*! \brief Starts a section when saving
+    \param cp Pointer to a checkpoint_t initialized with checkpoint_init_save
+    \param section Section type
+
+    Returns the position to pass to checkpoint_section_close once the section has been written
+*/
+size_t checkpoint_section_open(checkpoint_t* cp, checkpoint_section_t section);
+/*! \brief
+    \param
+*/
+void checkpoint_section_close(checkpoint_t* cp, size_t open);
+/*! \brief Reads the next section header when loading
+    \param cp Pointer to a checkpoint_t initialized with checkpoint_init_load
+    \param section Set to the type of the section, checkpoint_section_end at the end of the checkpoint
+    \param body Initialized to read only the body of the section
+
+    The section body is skipped in cp, so unknown sections can simply be ignored
+*/
+libcaption_stauts_t checkpoint_section_next(checkpoint_t* cp, checkpoint_section_t* section, checkpoint_t* body);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -9,23 +9,79 @@ extern "C" {
 
 #include <stddef.h>
 
-// TODO: determine if this is reasonable
-#define MAX_CC_CMDLIST_SIZE SCREEN_ROWS * SCREEN_COLS * 2 + 5
-
+/**
+ * A growable queue of cc_data blocks. Producers append with cmdlist_push, and a consumer
+ * drains from the front, typically a few blocks per video frame.
+ *
+ * A list must be initialized with cmdlist_init() and released with cmdlist_free(). A zeroed
+ * cc_data_cmdlist_t is also a valid empty list. Storage grows on demand and is kept by
+ * cmdlist_clear and by the builders that replace the contents of a list, so an uninitialized
+ * stack cc_data_cmdlist_t is not safe to pass to them.
+ */
 typedef struct {
-    uint16_t length;
-
-    cc_data_t commands[MAX_CC_CMDLIST_SIZE];
+    size_t length; // Number of queued commands
+    size_t head; // Position of the oldest command in commands
+    size_t capacity; // Zero or a power of two
+    cc_data_t* commands;
 } cc_data_cmdlist_t;
 
 /**
- * Pushes a single cc_data block into a cmdlist.
+ * Initializes an empty command list.
+ */
+void cmdlist_init(cc_data_cmdlist_t* cmdlist);
+
+/**
+ * Releases the storage of a command list, leaving it empty.
+ */
+void cmdlist_free(cc_data_cmdlist_t* cmdlist);
+
+/**
+ * Removes all commands from a command list in constant time. Storage is kept for reuse.
+ */
+static inline void cmdlist_clear(cc_data_cmdlist_t* cmdlist) { cmdlist->length = cmdlist->head = 0; }
+
+/**
+ * Pushes a single cc_data block onto the back of a cmdlist, growing it if needed.
  * @param cmdlist Command list to use.
  * @param int Whether the cc_data block is valid, per CEA-708.
  * @param cc_data 2-byte cc_data_1, cc_data_2.
  */
 libcaption_stauts_t cmdlist_push(cc_data_cmdlist_t* cmdlist, int valid, cea708_cc_type_t type, uint16_t cc_data);
 
+/**
+ * Returns a queued command without removing it.
+ * @param pos Index of the command, counted from the front of the queue.
+ * @return The command, or NULL if pos is past the end of the queue.
+ */
+static inline const cc_data_t* cmdlist_peek(const cc_data_cmdlist_t* cmdlist, size_t pos)
+{
+    return pos < cmdlist->length ? &cmdlist->commands[(cmdlist->head + pos) & (cmdlist->capacity - 1)] : NULL;
+}
+
+/**
+ * Removes commands from the front of a cmdlist.
+ * @param count Maximum number of commands to remove.
+ * @return Number of commands removed.
+ */
+size_t cmdlist_drain(cc_data_cmdlist_t* cmdlist, size_t count);
+
+/**
+ * Removes commands from the middle of a cmdlist, moving later commands down.
+ * @param pos Index of the first command to remove, counted from the front of the queue.
+ * @param count Maximum number of commands to remove.
+ * @return Number of commands removed.
+ */
+size_t cmdlist_erase(cc_data_cmdlist_t* cmdlist, size_t pos, size_t count);
+
+/**
+ * Moves commands from the front of a cmdlist into a cea708 block.
+ * @param cea708 Destination CEA-708 block
+ * @param cmdlist Source command list
+ * @param count Maximum number of commands to move. Fewer are moved if the block fills up.
+ * @return Number of commands moved.
+ */
+size_t cea708_drain_cmdlist(cea708_t* cea708, cc_data_cmdlist_t* cmdlist, size_t count);
+
 /*!
  * Adds a single command from a command list to a cea708 block.
  * @param cea708 Destination CEA-708 block
@@ -7,6 +7,7 @@ extern "C" {
 
 #include "caption.h"
 #include "cea708_types.h"
+#include "checkpoint.h"
 #include "utf8.h"
 #include "cmdlist.h"
 
@@ -36,6 +37,15 @@ libcaption_stauts_t dtvcc_packet_start(dtvcc_packet_t* dtvcc, uint8_t cc_data1,
  */
 libcaption_stauts_t dtvcc_packet_data(dtvcc_packet_t* dtvcc, uint8_t cc_data1, uint8_t cc_data2, uint8_t* pos);
 
+/**
+ * Saves or restores a partially received DTVCC packet.
+ *
+ * @param cp Checkpoint to write to or read from
+ * @param dtvcc DTVCC packet
+ * @param pos Current byte offset of the packet, 0 if no packet has been started
+ */
+libcaption_stauts_t dtvcc_packet_checkpoint(checkpoint_t* cp, dtvcc_packet_t* dtvcc, uint8_t* pos);
+
 
 libcaption_stauts_t dtvcc_read_service_block(const dtvcc_packet_t* dtvcc, dtvcc_service_block_t* service_block, uint8_t* pos);
 
@@ -51,8 +61,18 @@ libcaption_stauts_t dtvcc_finish_service_blocks(dtvcc_packet_t* dtvcc, uint8_t s
 
 libcaption_stauts_t dtvcc_from_streaming_karaoke(dtvcc_service_block_t* service_block, const utf8_char_t* data, uint8_t* column);
 
+/**
+ * Replaces the contents of cmdlist with the cc_data blocks of a finished DTVCC packet.
+ * cmdlist must be initialized with cmdlist_init() and released with cmdlist_free().
+ */
 libcaption_stauts_t dtvcc_packet_to_cmdlist(const dtvcc_packet_t *dtvcc, cc_data_cmdlist_t *cmdlist);
 
+/**
+ * Appends the cc_data blocks of a finished DTVCC packet to cmdlist.
+ * cmdlist must be initialized with cmdlist_init() and released with cmdlist_free().
+ */
+libcaption_stauts_t dtvcc_packet_append_to_cmdlist(const dtvcc_packet_t *dtvcc, cc_data_cmdlist_t *cmdlist);
+
 ////////////////////////////////////////////////////////////////////////////////
 #ifdef __cplusplus
 }
@@ -71,6 +71,19 @@ static inline int eia608_parity_varify(uint16_t cc_data) { return eia608_parity_
     \param
 */
 static inline int eia608_parity_strip(uint16_t cc_data) { return cc_data & 0x7F7F; }
+/*! \brief Sets the parity bits of every word in an array
+    \param cc_data Words to update in place
+    \param count Number of words
+*/
+void eia608_parity_apply_many(uint16_t* cc_data, size_t count);
+/*! \brief Checks the parity bits of every word in an array
+    \param cc_data Words to check
+    \param count Number of words
+    \param failed If not NULL, receives (count + 63) / 64 bitmap words. Bit i % 64 of failed[i / 64] is set if cc_data[i] fails
+
+    Returns the number of words that failed
+*/
+size_t eia608_parity_varify_many(const uint16_t* cc_data, size_t count, uint64_t* failed);
 /*! \brief
     \param
 */
@@ -115,6 +128,50 @@ static inline int eia608_is_norpak(uint16_t cc_data) { return 0x1724 == (0x777C
 */
 static inline int eia608_is_padding(uint16_t cc_data) { return 0x8080 == cc_data; }
 
+// Classes are assigned in the order caption_frame_decode tests for them
+typedef enum {
+    eia608_class_invalid = 0, //< parity error
+    eia608_class_padding = 1,
+    eia608_class_xds = 2,
+    eia608_class_control = 3,
+    eia608_class_basicna = 4,
+    eia608_class_specialna = 5,
+    eia608_class_westeu = 6,
+    eia608_class_preamble = 7,
+    eia608_class_midrowchange = 8,
+    eia608_class_unknown = 9, //< valid parity, but not a command we decode
+} eia608_class_t;
+
+// Generated by eia608_class.py, indexed by the cc_data bits without parity
+#define EIA608_CLASS_TABLE_SIZE (128 * 128)
+extern const uint8_t eia608_class_table[EIA608_CLASS_TABLE_SIZE];
+/*! \brief Classifies a cc_data word and verifies its parity with a single table lookup
+    \param cc_data Word from the cc_data stream, with parity
+
+    Returns eia608_class_invalid if either byte fails the parity check
+*/
+static inline eia608_class_t eia608_classify(uint16_t cc_data)
+{
+    uint8_t entry = eia608_class_table[((cc_data >> 1) & 0x3F80) | (cc_data & 0x007F)];
+    return (((cc_data >> 8) & 0x80) | ((cc_data >> 1) & 0x40)) == (entry & 0xC0) ? (eia608_class_t)(entry & 0x0F) : eia608_class_invalid;
+}
+/*! \brief Classifies a cc_data word whose parity has already been verified
+    \param cc_data Word from the cc_data stream, with parity
+*/
+static inline eia608_class_t eia608_classify_unchecked(uint16_t cc_data)
+{
+    return (eia608_class_t)(eia608_class_table[((cc_data >> 1) & 0x3F80) | (cc_data & 0x007F)] & 0x0F);
+}
+
+// Generated by eia608_class.py, the UTF-8 bytes of each eia608_char_map entry padded to
+// a fixed width so a character can be copied without scanning for its terminator.
+// The entry at EIA608_CHAR_COUNT is empty.
+typedef struct {
+    utf8_char_t data[7];
+    uint8_t size;
+} eia608_utf8_t;
+extern const eia608_utf8_t eia608_utf8_map[EIA608_CHAR_COUNT + 1];
+
 ////////////////////////////////////////////////////////////////////////////////
 // preamble
 
@@ -166,8 +223,18 @@ uint16_t eia608_from_utf8_2(const utf8_char_t* c1, const utf8_char_t* c2);
     \param
 */
 uint16_t eia608_from_basicna(uint16_t bna1, uint16_t bna2);
-/*! \brief
-    \param
+/*! \brief Moves a cc_data word to data channel chan
+    \param cc_data Word from the cc_data stream, with parity
+    \param chan 0 for CC1/CC3, 1 for CC2/CC4
+
+    Control codes, preambles, midrow codes and extended characters carry the channel, basicna words are returned as is
+*/
+static inline uint16_t eia608_set_channel(uint16_t cc_data, int chan) { return 0x1000 == (0x7000 & cc_data) ? eia608_parity((cc_data & 0x77FF) | (chan ? 0x0800 : 0x0000)) : cc_data; }
+/*! \brief Decodes the characters carried by a cc_data word
+    \param char1 Receives the first character, must hold at least 5 bytes
+    \param char2 Receives the second character, must hold at least 5 bytes
+
+    Returns the number of characters decoded. Unused outputs are set to an empty string.
 */
 int eia608_to_utf8(uint16_t c, int* chan, utf8_char_t* char1, utf8_char_t* char2);
 ////////////////////////////////////////////////////////////////////////////////
@@ -176,13 +243,41 @@ int eia608_to_utf8(uint16_t c, int* chan, utf8_char_t* char1, utf8_char_t* char2
 */
 void eia608_dump(uint16_t cc_data);
 
-// Prepare a command list for later writing
+// Pushes the cc_data of one character, pairing basicna characters through prev_cc_data. A character left
+// in prev_cc_data must be pushed by the caller once no partner follows. cmdlist must be initialized with
+// cmdlist_init() and released with cmdlist_free()
+void push_cc_data(cc_data_cmdlist_t* cmdlist, uint16_t* prev_cc_data, uint16_t cc_data);
+// Replaces cmdlist with the commands for a pop-on caption of text, or a clear if text is NULL. cmdlist
+// must be initialized with cmdlist_init() and released with cmdlist_free()
 void cmdlist_for_text(cc_data_cmdlist_t* cmdlist, const utf8_char_t* text);
-
+// Replaces cmdlist with the commands for a pop-on caption of frame. cmdlist must be initialized with
+// cmdlist_init() and released with cmdlist_free()
 libcaption_stauts_t commands_for_frame(cc_data_cmdlist_t* cmdlist, caption_frame_t* frame);
+// Appends the commands for a pop-on caption of frame without clearing cmdlist first. cmdlist must be
+// initialized with cmdlist_init() and released with cmdlist_free()
+libcaption_stauts_t cmdlist_append_frame(cc_data_cmdlist_t* cmdlist, caption_frame_t* frame);
+// Replaces cmdlist with the result of cmdlist_append_frame_delta. cmdlist must be initialized with
+// cmdlist_init() and released with cmdlist_free()
+libcaption_stauts_t commands_for_frame_delta(cc_data_cmdlist_t* cmdlist, caption_frame_t* prev, caption_frame_t* next);
+// Appends the commands that turn the displayed caption of prev into that of next. Changed cells are
+// edited in place with paint-on commands, unless a pop-on caption of next is no longer. A NULL prev
+// always pops on. Appends nothing if the captions match. cmdlist must be initialized with cmdlist_init()
+// and released with cmdlist_free()
+libcaption_stauts_t cmdlist_append_frame_delta(cc_data_cmdlist_t* cmdlist, caption_frame_t* prev, caption_frame_t* next);
+// Replaces cmdlist with the commands that clear the displayed caption. cmdlist must be initialized with
+// cmdlist_init() and released with cmdlist_free()
 libcaption_stauts_t cmdlist_from_caption_clear(cc_data_cmdlist_t* cmdlist);
+// Replaces cmdlist with the commands that clear displayed and non-displayed memory. cmdlist must be
+// initialized with cmdlist_init() and released with cmdlist_free()
 libcaption_stauts_t cmdlist_from_caption_fullreset(cc_data_cmdlist_t* cmdlist);
+// Replaces cmdlist with roll-up commands for data. cmdlist must be initialized with cmdlist_init() and
+// released with cmdlist_free()
 libcaption_stauts_t cmdlist_from_streaming_text(cc_data_cmdlist_t* cmdlist, const utf8_char_t* data);
+// Appends roll-up commands for data without clearing cmdlist first. cmdlist must be initialized with
+// cmdlist_init() and released with cmdlist_free()
+libcaption_stauts_t cmdlist_append_streaming_text(cc_data_cmdlist_t* cmdlist, const utf8_char_t* data);
+// Replaces cmdlist with roll-up commands for data, continuing the line at *column. cmdlist must be
+// initialized with cmdlist_init() and released with cmdlist_free()
 libcaption_stauts_t cmdlist_from_streaming_karaoke(cc_data_cmdlist_t* cmdlist, const utf8_char_t* data, uint8_t* column);
 
 
@@ -27,9 +27,24 @@
 extern "C" {
 #endif
 
+#include "utf8.h"
+
 #define EIA608_CHAR_COUNT 176
 extern const char* eia608_char_map[EIA608_CHAR_COUNT];
 
+// Generated by from_utf8.py. eia608_from_codepoint_block[codepoint >> 6] selects a block of
+// 64 cc_data values in eia608_from_codepoint. The first 128 entries are the ASCII range.
+#define EIA608_FROM_CODEPOINT_LIMIT 0x2700
+extern const uint8_t eia608_from_codepoint_block[EIA608_FROM_CODEPOINT_LIMIT >> 6];
+extern const uint16_t eia608_from_codepoint[];
+
+/*! \brief Looks up the cc_data of a single UTF-8 character
+    \param s UTF-8 character
+
+    Returns 0 if the character has no EIA-608 equivalent, or s is NULL
+*/
+uint16_t _eia608_from_utf8(const utf8_char_t* s);
+
 // Helper char
 #define EIA608_CHAR_NULL ""
 // Basic North American character set
@@ -29,6 +29,8 @@ extern "C" {
 
 #include "caption.h"
 #include "cea708.h"
+#include "checkpoint.h"
+#include "dtvcc.h"
 #include "scc.h"
 #include <float.h>
 #include <stddef.h>
@@ -70,6 +72,34 @@ static inline libcaption_stauts_t mpeg_bitstream_status(mpeg_bitstream_t* packet
     \param
 */
 size_t mpeg_bitstream_flush(mpeg_bitstream_t* packet, caption_frame_t* frame, dtvcc_packet_t* dtvcc, uint8_t *dtvcc_pos);
+/*! \brief Saves or restores the partial NALU and the reorder queue of a mpeg_bitstream_t
+    \param cp A checkpoint_t initialized with checkpoint_init_save or checkpoint_init_load
+    \param packet Pointer to a mpeg_bitstream_t
+*/
+libcaption_stauts_t mpeg_bitstream_checkpoint(checkpoint_t* cp, mpeg_bitstream_t* packet);
+/*! \brief Saves the complete decoder state used by mpeg_bitstream_parse
+    \param packet Bitstream state, or NULL to skip
+    \param frame Caption frame, or NULL to skip
+    \param dtvcc Partial DTVCC packet, or NULL to skip
+    \param dtvcc_pos Position in the DTVCC packet
+    \param data Destination buffer, or NULL to measure
+    \param size Size of the destination buffer
+
+    Returns the number of bytes written, or required when data is NULL. Returns 0 if the buffer is too small
+*/
+size_t mpeg_bitstream_save(mpeg_bitstream_t* packet, caption_frame_t* frame, dtvcc_packet_t* dtvcc, uint8_t* dtvcc_pos, uint8_t* data, size_t size);
+/*! \brief Restores decoder state saved with mpeg_bitstream_save
+    \param packet Initialized bitstream state, or NULL to skip
+    \param frame Initialized caption frame, or NULL to skip
+    \param dtvcc DTVCC packet, or NULL to skip
+    \param dtvcc_pos Position in the DTVCC packet
+    \param data Checkpoint data
+    \param size Size of the checkpoint data
+
+    Objects without a section in the checkpoint are left untouched. On LIBCAPTION_ERROR the
+    restored objects must be initialized again before use
+*/
+libcaption_stauts_t mpeg_bitstream_load(mpeg_bitstream_t* packet, caption_frame_t* frame, dtvcc_packet_t* dtvcc, uint8_t* dtvcc_pos, const uint8_t* data, size_t size);
 ////////////////////////////////////////////////////////////////////////////////
 typedef enum {
     sei_type_buffering_period = 0,
@@ -172,6 +202,18 @@ These messages will be freed by calling sei_free()
 */
 void sei_message_free(sei_message_t* msg);
 ////////////////////////////////////////////////////////////////////////////////
+/*! \brief Upper bound of the rendered size of one sei message
+    \param type Message type
+    \param size Payload size in bytes, before emulation prevention
+*/
+size_t sei_message_render_size(sei_msgtype_t type, size_t size);
+/*! \brief Renders one sei message, without the nal unit type or stop bit
+    \param data At least sei_message_render_size(type, payload_size) bytes
+
+    Returns the number of bytes written, including emulation prevention, or 0 on error.
+    Lets a caller build a sei nal unit in its own buffer without allocating sei_message_t objects
+*/
+size_t sei_message_render(sei_msgtype_t type, const uint8_t* payload, size_t payload_size, uint8_t* data);
 /*! \brief
     \param
 */
@@ -0,0 +1,84 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#ifndef LIBCAPTION_ROLLUP_ENCODER_H
+#define LIBCAPTION_ROLLUP_ENCODER_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "cmdlist.h"
+#include "utf8.h"
+
+// Encodes live text as roll-up captions a chunk at a time. The cursor, the pending word space and
+// a basicna character waiting for its partner carry over between chunks, so each chunk only adds
+// the cc_data for its own characters
+typedef struct {
+    uint8_t rows; //< roll-up depth, 2 to 4
+    uint8_t row; //< base row the text is written on
+    uint8_t col; //< cursor column on the base row
+    uint8_t started; //< roll-up mode and the base row have been sent
+    uint8_t space; //< a space is due before the next word
+    uint16_t prev_cc_data; //< basicna character waiting for a partner
+} rollup_encoder_t;
+
+/*! \brief Initializes a rollup_encoder_t
+    \param enc Pointer to prealocated rollup_encoder_t object
+    \param rows Number of rows that stay on screen, 2 to 4
+    \param row Base row the text is written on, 0-indexed. Raised so all rows fit on screen
+*/
+void rollup_encoder_init(rollup_encoder_t* enc, int rows, int row);
+/*! \brief Appends the cc_data for a chunk of text to cmdlist
+    \param enc A pointer to an initialized rollup_encoder_t object
+    \param cmdlist Command list to append to, initialized with cmdlist_init(). It is not cleared
+    \param data UTF-8 text. Whitespace separates words, runs of it become a single space
+
+    Words move to a new line when they do not fit on the current one. A chunk that does not start
+    with whitespace continues the last word, it is broken at the end of the line if it no longer fits.
+    A final basicna character is held back to pair with the next chunk, see rollup_encoder_flush
+*/
+libcaption_stauts_t rollup_encoder_append(rollup_encoder_t* enc, cc_data_cmdlist_t* cmdlist, const utf8_char_t* data);
+/*! \brief Appends the basicna character held back by rollup_encoder_append, if any
+    \param enc A pointer to an initialized rollup_encoder_t object
+    \param cmdlist Command list to append to, initialized with cmdlist_init()
+
+    Call when no more text is expected soon, so the last character is not delayed
+*/
+libcaption_stauts_t rollup_encoder_flush(rollup_encoder_t* enc, cc_data_cmdlist_t* cmdlist);
+/*! \brief Ends the current line, the next text starts on a new one
+    \param enc A pointer to an initialized rollup_encoder_t object
+    \param cmdlist Command list to append to, initialized with cmdlist_init()
+*/
+libcaption_stauts_t rollup_encoder_newline(rollup_encoder_t* enc, cc_data_cmdlist_t* cmdlist);
+/*! \brief Erases the displayed captions, the next text starts a new roll-up
+    \param enc A pointer to an initialized rollup_encoder_t object
+    \param cmdlist Command list to append to, initialized with cmdlist_init()
+
+    A character held back by rollup_encoder_append is dropped
+*/
+libcaption_stauts_t rollup_encoder_clear(rollup_encoder_t* enc, cc_data_cmdlist_t* cmdlist);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
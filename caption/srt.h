@@ -73,6 +73,28 @@ static inline srt_cue_t* srt_cue_from_caption_frame(caption_frame_t* frame, srt_
 */
 static inline void srt_cue_free_head(srt_t* srt) { vtt_cue_free_head(srt); };
 
+typedef vtt_parser_t srt_parser_t;
+
+/*! \brief
+    \param
+*/
+static inline void srt_parser_init(srt_parser_t* parser, srt_t* srt) { vtt_parser_init(parser, srt, 1); };
+
+/*! \brief
+    \param
+*/
+static inline void srt_parser_free(srt_parser_t* parser) { vtt_parser_free(parser); };
+
+/*! \brief
+    \param
+*/
+static inline libcaption_stauts_t srt_parser_push(srt_parser_t* parser, const utf8_char_t* data, size_t size) { return vtt_parser_push(parser, data, size); };
+
+/*! \brief
+    \param
+*/
+static inline libcaption_stauts_t srt_parser_flush(srt_parser_t* parser) { return vtt_parser_flush(parser); };
+
 /*! \brief
     \param
 */
@@ -83,6 +105,50 @@ static inline srt_cue_t* srt_cue_new(srt_t* srt, const utf8_char_t* data, size_t
 */
 static inline int srt_cue_to_caption_frame(srt_cue_t* cue, caption_frame_t* frame) { return vtt_cue_to_caption_frame(cue, frame); };
 
+typedef vtt_writer_t srt_writer_t;
+
+/*! \brief
+    \param
+*/
+static inline void srt_writer_init(srt_writer_t* writer, int fd) { vtt_writer_init(writer, fd, 1); };
+
+/*! \brief
+    \param
+*/
+static inline void srt_writer_free(srt_writer_t* writer) { vtt_writer_free(writer); };
+
+/*! \brief
+    \param
+*/
+static inline libcaption_stauts_t srt_writer_cue(srt_writer_t* writer, srt_cue_t* cue) { return vtt_writer_cue(writer, cue); };
+
+/*! \brief
+    \param
+*/
+static inline libcaption_stauts_t srt_writer_flush(srt_writer_t* writer) { return vtt_writer_flush(writer); };
+
+typedef vtt_emitter_t srt_emitter_t;
+
+/*! \brief
+    \param
+*/
+static inline libcaption_stauts_t srt_emitter_init(srt_emitter_t* emitter, int fd) { return vtt_emitter_init(emitter, fd, 1); };
+
+/*! \brief
+    \param
+*/
+static inline void srt_emitter_free(srt_emitter_t* emitter) { vtt_emitter_free(emitter); };
+
+/*! \brief
+    \param
+*/
+static inline libcaption_stauts_t srt_emitter_frame(srt_emitter_t* emitter, caption_frame_t* frame) { return vtt_emitter_frame(emitter, frame); };
+
+/*! \brief
+    \param
+*/
+static inline libcaption_stauts_t srt_emitter_finish(srt_emitter_t* emitter) { return vtt_emitter_finish(emitter); };
+
 void srt_dump(srt_t* srt);
 /*! \brief
     \param
@@ -50,6 +50,13 @@ const utf8_char_t* utf8_char_next(const utf8_char_t* c);
     returnes the length of the char in bytes
 */
 size_t utf8_char_length(const utf8_char_t* c);
+/*! \brief
+    \param
+
+    returns the unicode codepoint of the first character. NULL, an empty string and
+    truncated or overlong sequences return 0
+*/
+uint32_t utf8_char_codepoint(const utf8_char_t* c);
 
 /*! \brief
     \param
@@ -106,13 +113,25 @@ int utf8_line_count(const utf8_char_t* data);
 
 /*! \brief
     \param
-    size in/out. In the the max seize, out is the size read;
-    returns number of new lins in teh string
+    size in/out. In the max size, 0 for no limit, out is the size read;
+    returns a null terminated copy of the file that must be freed, or NULL on error
 */
-#define UFTF_DEFAULT_MAX_FILE_SIZE = (50 * 1024 * 1024);
-
 utf8_char_t* utf8_load_text_file(const char* path, size_t* size);
 
+/*! \brief Maps a text file read only
+    \param size Set to the size of the file
+
+    The view is followed by at least one zero byte, so it can be parsed as a null terminated
+    string. Nothing is copied, so a large file does not cost its size twice.
+    Returns NULL on error. Release the view with utf8_unmap_text_file
+*/
+const utf8_char_t* utf8_map_text_file(const char* path, size_t* size);
+
+/*! \brief Releases a view returned by utf8_map_text_file
+    \param
+*/
+void utf8_unmap_text_file(const utf8_char_t* data, size_t size);
+
 /*! \brief
     \param
 
@@ -38,6 +38,8 @@ enum VTT_BLOCK_TYPE {
     VTT_CUE = 3
 };
 
+struct _vtt_chunk_t;
+
 // CUE represents a block of caption text
 typedef struct _vtt_block_t {
     struct _vtt_block_t* next;
@@ -45,8 +47,9 @@ typedef struct _vtt_block_t {
     // CUE-Only
     double timestamp;
     double duration; // -1.0 for no duration
-    char* cue_settings;
-    char* cue_id;
+    char* cue_settings; // owned by the vtt_t, do not free
+    char* cue_id; // owned by the vtt_t, do not free
+    struct _vtt_chunk_t* chunk; // arena chunk the block was allocated from
     // Standard block data
     size_t text_size;
     char* block_text;
@@ -54,6 +57,10 @@ typedef struct _vtt_block_t {
 
 // VTT files are a collection of REGION, STYLE and CUE blocks.
 // XXX: Comments (NOTE blocks) are ignored
+// Blocks, with their text, id and settings, are allocated from chunks owned by the vtt_t.
+// vtt_free releases the chunks without walking the blocks. The *_free_head functions drop
+// a block's reference on its chunk, and a chunk is released once none of its blocks remain,
+// so a stream that frees cues as it consumes them does not grow without bound.
 typedef struct _vtt_t {
     vtt_block_t* region_head;
     vtt_block_t* region_tail;
@@ -61,6 +68,7 @@ typedef struct _vtt_t {
     vtt_block_t* style_tail;
     vtt_block_t* cue_head;
     vtt_block_t* cue_tail;
+    struct _vtt_chunk_t* chunk_head; // most recent chunk, the one being allocated from
 } vtt_t;
 
 /*! \brief
@@ -103,6 +111,42 @@ vtt_t* vtt_parse(const utf8_char_t* data, size_t size);
 */
 vtt_t* _vtt_parse(const utf8_char_t* data, size_t size, int srt_mode);
 
+// Incremental parser for live input. Data may be pushed in chunks of any size. Each block
+// is parsed, and appended to vtt, as soon as the blank line ending it arrives. Only the
+// incomplete block is buffered, so cues can be consumed with vtt_cue_free_head as they come.
+typedef struct {
+    vtt_t* vtt;
+    int srt_mode;
+    int header; // the WEBVTT header block has not been seen yet
+    size_t lines; // non blank lines in the pending block
+    size_t scan; // offset of the first line not examined yet
+    size_t size;
+    size_t aloc;
+    utf8_char_t* data; // the pending block, null terminated
+} vtt_parser_t;
+
+/*! \brief Initializes a parser that appends to vtt
+    \param srt_mode Non zero to parse SRT, which has no WEBVTT header
+*/
+void vtt_parser_init(vtt_parser_t* parser, vtt_t* vtt, int srt_mode);
+/*! \brief Releases the buffer of a parser, but not its vtt
+    \param
+*/
+void vtt_parser_free(vtt_parser_t* parser);
+/*! \brief Appends data, which must not contain a null byte, and parses every completed block
+    \param
+
+    Returns LIBCAPTION_READY if at least one cue was appended, LIBCAPTION_ERROR if a block
+    could not be parsed. A bad block is dropped and parsing continues with the next one
+*/
+libcaption_stauts_t vtt_parser_push(vtt_parser_t* parser, const utf8_char_t* data, size_t size);
+/*! \brief Ends the document, parsing a last block that was not followed by a blank line
+    \param
+
+    The parser can be reused for the next document. Returns as vtt_parser_push
+*/
+libcaption_stauts_t vtt_parser_flush(vtt_parser_t* parser);
+
 /*! \brief
     \param
 */
@@ -137,11 +181,127 @@ int vtt_cue_to_caption_frame(vtt_block_t* cue, caption_frame_t* frame);
     \param
 */
 vtt_block_t* vtt_cue_from_caption_frame(caption_frame_t* frame, vtt_t* vtt);
+
+#define VTT_WRITER_BUFFER_SIZE 8192
+
+// Renders blocks as WebVTT, or SRT, text into a growable buffer. With an fd the buffer is
+// written out whenever VTT_WRITER_BUFFER_SIZE bytes accumulate, so cues can be written as
+// they are produced. With an fd of -1 the text stays in data for the caller, who may reset
+// size to reuse the buffer
+typedef struct {
+    int fd;
+    int srt_mode;
+    size_t count; // cues written, SRT cues are numbered from 1
+    size_t size;
+    size_t aloc;
+    utf8_char_t* data; // not null terminated
+} vtt_writer_t;
+
+/*! \brief
+    \param fd File descriptor to write to, or -1 to only buffer
+    \param srt_mode Non zero to write SRT
+*/
+void vtt_writer_init(vtt_writer_t* writer, int fd, int srt_mode);
+/*! \brief Releases the buffer without writing it
+    \param
+*/
+void vtt_writer_free(vtt_writer_t* writer);
+/*! \brief Writes the WEBVTT header with the regions and styles of vtt. Nothing in srt_mode
+    \param
+*/
+libcaption_stauts_t vtt_writer_header(vtt_writer_t* writer, vtt_t* vtt);
+/*! \brief
+    \param
+*/
+libcaption_stauts_t vtt_writer_cue(vtt_writer_t* writer, vtt_block_t* cue);
+/*! \brief Writes anything buffered to the fd
+    \param
+
+    stdout is flushed first when the fd is 1, so earlier printf output stays in order
+*/
+libcaption_stauts_t vtt_writer_flush(vtt_writer_t* writer);
+/*! \brief Writes a whole document, header and cues, to fd
+    \param
+*/
+libcaption_stauts_t vtt_write(vtt_t* vtt, int fd, int srt_mode);
 /*! \brief
     \param
 */
 void vtt_dump(vtt_t* vtt);
 
+// Turns decoded caption frames into cues for a live source. A cue is written, and freed, as
+// soon as the next frame gives it a duration, so memory stays constant and output trails the
+// input by one caption
+typedef struct {
+    vtt_t* vtt; // holds only the cue waiting for its duration
+    vtt_writer_t writer;
+} vtt_emitter_t;
+
+/*! \brief Writes the WEBVTT header, unless srt_mode is set
+    \param fd File descriptor the cues are written to
+
+    Returns LIBCAPTION_ERROR if memory could not be allocated or the header not written
+*/
+libcaption_stauts_t vtt_emitter_init(vtt_emitter_t* emitter, int fd, int srt_mode);
+/*! \brief Releases the emitter, without writing the pending cue
+    \param
+*/
+void vtt_emitter_free(vtt_emitter_t* emitter);
+/*! \brief Starts a cue from frame and writes the cue it ends
+    \param
+*/
+libcaption_stauts_t vtt_emitter_frame(vtt_emitter_t* emitter, caption_frame_t* frame);
+/*! \brief Writes the pending cue, which has no known duration, at the end of the input
+    \param
+*/
+libcaption_stauts_t vtt_emitter_finish(vtt_emitter_t* emitter);
+
+typedef struct {
+    double start;
+    double end;
+    double max_end; // largest end of this entry and every entry before it
+    size_t order; // position in the cue list, keeps equal start times in file order
+    vtt_block_t* cue;
+} vtt_index_entry_t;
+
+// Cues sorted by start time, with a running maximum of their end times. Answers "which cues
+// overlap [start, end)" with two binary searches and a scan of the cues that may overlap, so
+// the input does not need to be in order. The index points into the vtt_t, which must outlive
+// it and must not have cues removed while it is in use
+typedef struct {
+    size_t count;
+    vtt_index_entry_t* entries;
+} vtt_index_t;
+
+typedef struct {
+    const vtt_index_t* index;
+    double start;
+    size_t pos;
+    size_t last; // one past the last entry that starts early enough
+} vtt_index_iter_t;
+
+/*! \brief Builds an index of every cue in vtt
+    \param
+
+    Returns LIBCAPTION_ERROR if memory could not be allocated
+*/
+libcaption_stauts_t vtt_index_init(vtt_index_t* index, vtt_t* vtt);
+/*! \brief
+    \param
+*/
+void vtt_index_free(vtt_index_t* index);
+/*! \brief Finds the cues overlapping [start, end), in start time order
+    \param iter Filled in, pass to vtt_index_iter_next for the following cues
+
+    A cue overlaps if it starts before end and ends after start. When end equals start the
+    cues active at that instant are returned. Returns NULL if there are none
+*/
+vtt_block_t* vtt_index_query(const vtt_index_t* index, double start, double end, vtt_index_iter_t* iter);
+/*! \brief
+    \param
+*/
+vtt_block_t* vtt_index_iter_next(vtt_index_iter_t* iter);
+
 #ifdef __cplusplus
 }
 #endif
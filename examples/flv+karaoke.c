@@ -254,7 +254,7 @@ int main(int argc, char** argv)
     srt_t* old_srt = NULL;
     srt_cue_t* next_cue = NULL;
     cc_data_cmdlist_t next_cmdlist;
-    uint16_t next_cmdlist_pos = 0;
+    int next_cue_started = 0;
     double timestamp, latest_time = 0, offset = 0;
     int has_audio, has_video;
     uint8_t did_something = 0;
@@ -276,7 +276,7 @@ int main(int argc, char** argv)
     FILE* out = flv_open_write(argv[3]);
 
     flvtag_init(&tag);
-    memset(&next_cmdlist, 0, sizeof(cc_data_cmdlist_t));
+    cmdlist_init(&next_cmdlist);
     timecode_ring_init(&ring);
 
     if (!flv_read_header(flv, &has_audio, &has_video)) {
@@ -303,7 +303,7 @@ int main(int argc, char** argv)
             old_srt = cur_srt;
             offset = timestamp;
             next_cue = cur_srt->cue_head;
-            next_cmdlist_pos = 0;
+            next_cue_started = 0;
             cmdlist_from_streaming_karaoke_dtvcc(&next_cmdlist, srt_cue_data(next_cue), &column, &sequence);
             // cmdlist_from_streaming_karaoke(&next_cmdlist, srt_cue_data(next_cue), &column);
         }
@@ -319,26 +319,26 @@ int main(int argc, char** argv)
                 /* if (clear_timestamp >= 0 && timestamp >= clear_timestamp) {
                     // TODO: clear this nicer
                     fprintf(stderr, "T: %0.02f: [CAPTIONS CLEARED]\n", timestamp);
-                    uint16_t p = 0;
-                    sei_for_remaining_commands(&tag, &clearlist, &p);
+                    sei_for_remaining_commands(&tag, &clearlist);
                     did_something = 1;
                     clear_timestamp = -1;
                 } else */
                 if (next_cue) {
                     // There is a pending cue, try to push that out.
-                    if (timestamp >= (offset + next_cue->timestamp) && next_cmdlist_pos < next_cmdlist.length) {
+                    if (timestamp >= (offset + next_cue->timestamp) && 0 < next_cmdlist.length) {
                         // We should send some of that cue!
-                        if (next_cmdlist_pos == 0) {
+                        if (!next_cue_started) {
+                            next_cue_started = 1;
                             fprintf(stderr, "T: %0.02f: Cue %0.02f (%0.02fs):\n%s\n", timestamp, (offset + next_cue->timestamp), next_cue->duration, srt_cue_data(next_cue));
                         }
 
-                        sei_for_n_commands(&tag, &next_cmdlist, &next_cmdlist_pos, 10);
+                        sei_for_n_commands(&tag, &next_cmdlist, 10);
                         did_something = 1;
 
-                        if (next_cmdlist_pos >= next_cmdlist.length) {
+                        if (0 == next_cmdlist.length) {
                             // We need to reload!
                             next_cue = next_cue->next;
-                            next_cmdlist_pos = 0;
+                            next_cue_started = 0;
                             if (next_cue) {
                                 fprintf(stderr, "LINE!\n");
                                 cmdlist_from_streaming_karaoke_dtvcc(&next_cmdlist, srt_cue_data(next_cue), &column, &sequence);
@@ -351,7 +351,7 @@ int main(int argc, char** argv)
 
             if (!did_something) {
                 // Fill in blanks
-                sei_for_remaining_commands(&tag, NULL, NULL);
+                sei_for_remaining_commands(&tag, NULL);
                 did_something = 1;
             }
         }
@@ -360,6 +360,7 @@ int main(int argc, char** argv)
     }
 
     srt_free(old_srt);
+    cmdlist_free(&next_cmdlist);
     flvtag_free(&tag);
     flv_close(flv);
     flv_close(out);
@@ -37,8 +37,8 @@ int main(int argc, char** argv)
     }
 
     FILE* flv = flv_open_read(argv[1]);
-    utf8_char_t* scc_data_ptr = utf8_load_text_file(argv[2], &scc_size);
-    utf8_char_t* scc_data = scc_data_ptr;
+    const utf8_char_t* scc_data_ptr = utf8_map_text_file(argv[2], &scc_size);
+    const utf8_char_t* scc_data = scc_data_ptr;
     FILE* out = flv_open_write(argv[3]);
 
     if (!flv) {
@@ -80,7 +80,7 @@ int main(int argc, char** argv)
         flv_write_tag(out, &tag);
     }
 
-    free(scc_data_ptr);
+    utf8_unmap_text_file(scc_data_ptr, scc_size);
     flvtag_free(&tag);
     return EXIT_SUCCESS;
 }
@@ -165,7 +165,6 @@ int main(int argc, char** argv)
     srt_t* old_srt = NULL;
     srt_cue_t* next_cue = NULL;
     cc_data_cmdlist_t next_cmdlist, clearlist;
-    uint16_t next_cmdlist_pos = 0;
     double timestamp, latest_time = 0, offset = 0, clear_timestamp = 0;
     int has_audio, has_video;
     uint8_t did_something = 0;
@@ -185,8 +184,8 @@ int main(int argc, char** argv)
     FILE* out = flv_open_write(argv[3]);
 
     flvtag_init(&tag);
-    memset(&next_cmdlist, 0, sizeof(cc_data_cmdlist_t));
-    cmdlist_for_text(&clearlist, NULL);
+    cmdlist_init(&next_cmdlist);
+    cmdlist_init(&clearlist);
     timecode_ring_init(&ring);
 
     if (!flv_read_header(flv, &has_audio, &has_video)) {
@@ -214,7 +213,6 @@ int main(int argc, char** argv)
             offset = timestamp;
             clear_timestamp = timestamp;
             next_cue = cur_srt->cue_head;
-            next_cmdlist_pos = 0;
             cmdlist_for_text(&next_cmdlist, srt_cue_data(next_cue));
         }
 
@@ -229,34 +227,33 @@ int main(int argc, char** argv)
                 if (clear_timestamp >= 0 && timestamp >= clear_timestamp) {
                     // TODO: clear this nicer
                     fprintf(stderr, "T: %0.02f: [CAPTIONS CLEARED]\n", timestamp);
-                    uint16_t p = 0;
-                    sei_for_remaining_commands(&tag, &clearlist, &p);
+                    cmdlist_for_text(&clearlist, NULL);
+                    sei_for_remaining_commands(&tag, &clearlist);
                     did_something = 1;
                     clear_timestamp = -1;
                 } else if (next_cue) {
                     // There is a pending cue, try to push that out.
                     if ((offset + next_cue->timestamp) <= timestamp) {
                         // We're at or past our cue time.
-                        // fprintf(stderr, "Buffer state: %" PRIu16 " of %" PRIu16 "\n", next_cmdlist_pos, next_cmdlist.length);
+                        // fprintf(stderr, "Buffer state: %zu left\n", next_cmdlist.length);
                         fprintf(stderr, "T: %0.02f: Cue %0.02f (%0.02fs):\n%s\n", timestamp, (offset + next_cue->timestamp), next_cue->duration, srt_cue_data(next_cue));
                         clear_timestamp = (offset + next_cue->timestamp) + next_cue->duration;
 
                         // Push out whatever we have left, it's cue time!
-                        sei_for_remaining_commands(&tag, &next_cmdlist, &next_cmdlist_pos);
+                        sei_for_remaining_commands(&tag, &next_cmdlist);
                         did_something = 1;
 
                         // Set up for next cue
                         next_cue = next_cue->next;
-                        next_cmdlist_pos = 0;
                         if (next_cue) {
                             cmdlist_for_text(&next_cmdlist, srt_cue_data(next_cue));
                         }
-                    } else if (next_cmdlist_pos < next_cmdlist.length - 1) {
+                    } else if (1 < next_cmdlist.length) {
                         // We're not yet at the next cue time, buffer up the next thing.
-                        // fprintf(stderr, "T: %0.02f: Buffering next caption for %0.02f: %" PRIu16 " of %" PRIu16 "\n", timestamp, (offset + next_cue->timestamp), next_cmdlist_pos, next_cmdlist.length);
+                        // fprintf(stderr, "T: %0.02f: Buffering next caption for %0.02f: %zu left\n", timestamp, (offset + next_cue->timestamp), next_cmdlist.length);
                         // There is more than 1 command left to insert (last is EOC)
 
-                        sei_for_n_commands(&tag, &next_cmdlist, &next_cmdlist_pos, /* next_cmdlist_pos < next_cmdlist.length - 2 ? 2 : */ 1);
+                        sei_for_n_commands(&tag, &next_cmdlist, 1);
                         did_something = 1;
                     }
                 }
@@ -264,7 +261,7 @@ int main(int argc, char** argv)
 
             if (!did_something) {
                 // Fill in blanks
-                sei_for_remaining_commands(&tag, NULL, NULL);
+                sei_for_remaining_commands(&tag, NULL);
                 did_something = 1;
             }
         }
@@ -273,6 +270,8 @@ int main(int argc, char** argv)
     }
 
     srt_free(old_srt);
+    cmdlist_free(&next_cmdlist);
+    cmdlist_free(&clearlist);
     flvtag_free(&tag);
     flv_close(flv);
     flv_close(out);
@@ -37,7 +37,7 @@
 #include <unistd.h>
 #endif
 
-#define MAX_SRT_SIZE (1 * 1024 * 1024)
+#define SRT_READ_SIZE 4096
 
 // retunes number of bytes read
 // negative number on error
@@ -78,34 +78,49 @@ size_t fd_read(int fd, uint8_t* data, size_t size, int* eof)
     return retval;
 }
 
-size_t g_srt_size = 0;
-utf8_char_t g_srt_data[MAX_SRT_SIZE];
-srt_t* srt_from_fd(int fd)
+// Feeds whatever is ready on fd to the parser, cues are appended as each one completes.
+// A NUL byte, or the end of the input, ends a document and the next byte starts a new one.
+// returns 1 if a new document started, the cues of the previous one are dropped
+int srt_from_fd(int fd, srt_t* srt, srt_parser_t* parser, int* fresh, int* eof)
 {
-    int eof;
-    uint8_t c;
+    utf8_char_t data[SRT_READ_SIZE];
+    int started = 0;
 
-    for (;;) {
-        size_t ret = fd_read(fd, &c, 1, &eof);
+    while (!(*eof)) {
+        size_t i, ret = fd_read(fd, (uint8_t*)&data[0], SRT_READ_SIZE, eof);
 
-        if (eof || (1 == ret && 0 == c)) {
-            srt_t* srt = srt_parse(&g_srt_data[0], g_srt_size);
-            g_srt_size = 0;
-            return srt;
+        if ((*eof)) {
+            srt_parser_flush(parser);
         }
 
-        if (1 == ret) {
-            if (g_srt_size >= MAX_SRT_SIZE - 1) {
-                fprintf(stderr, "Warning MAX_SRT_SIZE reached. Clearing buffer\n");
-                g_srt_size = 0;
+        if (0 == ret || SRT_READ_SIZE < ret) {
+            break;
+        }
+
+        for (i = 0; i < ret;) {
+            size_t len = strnlen(&data[i], ret - i);
+
+            if (0 < len && (*fresh)) {
+                while (srt->cue_head) {
+                    srt_cue_free_head(srt);
+                }
+
+                (*fresh) = 0;
+                started = 1;
             }
 
-            g_srt_data[g_srt_size] = c;
-            g_srt_size += 1;
-        } else {
-            return 0;
+            srt_parser_push(parser, &data[i], len);
+            i += len;
+
+            if (i < ret) { // NUL
+                srt_parser_flush(parser);
+                (*fresh) = 1;
+                ++i;
+            }
         }
     }
+
+    return started;
 }
 
 int should_do_things(timecode_ring_t* ring, double new_ts) {
@@ -162,17 +177,16 @@ nothing:
 int main(int argc, char** argv)
 {
     flvtag_t tag;
-    srt_t* old_srt = NULL;
-    srt_cue_t* next_cue = NULL;
-    cc_data_cmdlist_t next_cmdlist;
-    uint16_t next_cmdlist_pos = 0;
+    srt_t* srt = srt_new();
+    srt_parser_t parser;
+    cc_scheduler_t sched;
     double timestamp, latest_time = 0, offset = 0;
-    int has_audio, has_video;
+    int has_audio, has_video, fresh = 1, eof = 0;
     uint8_t did_something = 0;
     timecode_ring_t ring;
 
-    if (argc != 4) {
-        fprintf(stderr, "Usage: %s <input_flv> <input_srt> <output_flv>\n", argv[0]);
+    if (argc != 4 && argc != 5) {
+        fprintf(stderr, "Usage: %s <input_flv> <input_srt> <output_flv> [frame_rate]\n", argv[0]);
         return 1;
     }
 
@@ -185,7 +199,9 @@ int main(int argc, char** argv)
     FILE* out = flv_open_write(argv[3]);
 
     flvtag_init(&tag);
-    memset(&next_cmdlist, 0, sizeof(cc_data_cmdlist_t));
+    srt_parser_init(&parser, srt);
+    // Captions are paced by the scheduler, one frame worth of cc_data per video frame
+    cc_scheduler_init(&sched, 5 == argc ? atof(argv[4]) : CC_SCHEDULER_608_RATE);
     timecode_ring_init(&ring);
 
     if (!flv_read_header(flv, &has_audio, &has_video)) {
@@ -201,19 +217,12 @@ int main(int argc, char** argv)
 
     while (flv_read_tag(flv, &tag)) {
 
-        srt_t* cur_srt = srt_from_fd(fd);
         timestamp = flvtag_pts_seconds(&tag);
 
-        if (cur_srt) {
-            fprintf(stderr, "Loaded new SRT at time %f\n", timestamp);
-            if (old_srt != NULL) {
-                srt_free(old_srt);
-            }
-            old_srt = cur_srt;
+        if (srt_from_fd(fd, srt, &parser, &fresh, &eof)) {
+            fprintf(stderr, "Started new SRT at time %f\n", timestamp);
             offset = timestamp;
-            next_cue = cur_srt->cue_head;
-            next_cmdlist_pos = 0;
-            cmdlist_from_streaming_text(&next_cmdlist, srt_cue_data(next_cue));
+            cmdlist_clear(&sched.field[0]);
         }
 
         if (flvtag_avcpackettype_nalu == flvtag_avcpackettype(&tag) && flvtag_type_video == flvtag_type(&tag)) {
@@ -223,42 +232,21 @@ int main(int argc, char** argv)
             if (should_do_things(&ring, timestamp) && timestamp > latest_time) {
                 latest_time = timestamp;
 
-                // fprintf(stderr, "T: %0.02f, frame type = %d\n", timestamp, flvtag_frametype(&tag));
-                /* if (clear_timestamp >= 0 && timestamp >= clear_timestamp) {
-                    // TODO: clear this nicer
-                    fprintf(stderr, "T: %0.02f: [CAPTIONS CLEARED]\n", timestamp);
-                    uint16_t p = 0;
-                    sei_for_remaining_commands(&tag, &clearlist, &p);
-                    did_something = 1;
-                    clear_timestamp = -1;
-                } else */
-                if (next_cue) {
-                    // There is a pending cue, try to push that out.
-                    if (timestamp >= (offset + next_cue->timestamp) && next_cmdlist_pos < next_cmdlist.length) {
-                        // We should send some of that cue!
-                        if (next_cmdlist_pos == 0) {
-                            fprintf(stderr, "T: %0.02f: Cue %0.02f (%0.02fs):\n%s\n", timestamp, (offset + next_cue->timestamp), next_cue->duration, srt_cue_data(next_cue));
-                        }
-
-                        sei_for_n_commands(&tag, &next_cmdlist, &next_cmdlist_pos, 1);
-                        did_something = 1;
-
-                        if (next_cmdlist_pos >= next_cmdlist.length) {
-                            // We need to reload!
-                            next_cue = next_cue->next;
-                            next_cmdlist_pos = 0;
-                            if (next_cue) {
-                                fprintf(stderr, "LINE!\n");
-                                cmdlist_from_streaming_text(&next_cmdlist, srt_cue_data(next_cue));
-                            }
-                        }
-                    }
+                // Queue every cue that is due, the scheduler sends them at the 608 rate
+                // and a cue is released as soon as it is queued
+                for (; srt->cue_head && timestamp >= (offset + srt->cue_head->timestamp); srt_cue_free_head(srt)) {
+                    srt_cue_t* cue = srt->cue_head;
+                    fprintf(stderr, "T: %0.02f: Cue %0.02f (%0.02fs):\n%s\n", timestamp, (offset + cue->timestamp), cue->duration, srt_cue_data(cue));
+                    cmdlist_append_streaming_text(&sched.field[0], srt_cue_data(cue));
                 }
+
+                sei_for_scheduler(&tag, &sched);
+                did_something = 1;
             }
 
             if (!did_something) {
                 // Fill in blanks
-                sei_for_remaining_commands(&tag, NULL, NULL);
+                sei_for_remaining_commands(&tag, NULL);
                 did_something = 1;
             }
         }
@@ -266,7 +254,9 @@ int main(int argc, char** argv)
         flv_write_tag(out, &tag);
     }
 
-    srt_free(old_srt);
+    srt_parser_free(&parser);
+    srt_free(srt);
+    cc_scheduler_free(&sched);
     flvtag_free(&tag);
     flv_close(flv);
     flv_close(out);
@@ -313,7 +313,7 @@ int flvtag_amfcaption_utf8(flvtag_t* tag, uint32_t timestamp, const utf8_char_t*
 
 #define LENGTH_SIZE 4
 
-int flvtag_avcwritenal(flvtag_t* tag, uint8_t* data, size_t size)
+int flvtag_avcwritenal(flvtag_t* tag, const uint8_t* data, size_t size)
 {
     if (0 < size) {
         uint32_t flvsize = flvtag_size(tag);
@@ -383,6 +383,52 @@ int flvtag_addsei(flvtag_t* tag, sei_t* sei)
     return 1;
 }
 
+// Works in place, so a tag that already has room for the sei does not allocate
+int flvtag_addsei_nal(flvtag_t* tag, const uint8_t* sei_data, size_t sei_size)
+{
+    if (flvtag_avcpackettype_nalu != flvtag_avcpackettype(tag)) {
+        return 0;
+    }
+
+    size_t header_size = flvtag_size(tag) - flvtag_payload_size(tag);
+    size_t size = flvtag_payload_size(tag), read = 0, write = 0, insert = size;
+
+    while (read + LENGTH_SIZE < size) {
+        uint8_t* data = flvtag_payload_data(tag);
+        uint8_t nalu_type = data[read + LENGTH_SIZE] & 0x1F;
+        size_t nalu_size = LENGTH_SIZE + (((size_t)data[read] << 24) | ((size_t)data[read + 1] << 16) | ((size_t)data[read + 2] << 8) | (size_t)data[read + 3]);
+        nalu_size = nalu_size < size - read ? nalu_size : size - read;
+
+        // An empty nalu has no type byte, so the tag is malformed from here on
+        if (LENGTH_SIZE >= nalu_size) {
+            break;
+        }
+
+        if (6 != nalu_type) { // Replaced, as in flvtag_addsei
+            if (insert == size && 7 != nalu_type && 8 != nalu_type && 9 != nalu_type) {
+                insert = write;
+            }
+
+            memmove(&data[write], &data[read], nalu_size);
+            write += nalu_size;
+        }
+
+        read += nalu_size;
+    }
+
+    insert = insert < write ? insert : write;
+    flvtag_reserve(tag, (uint32_t)(header_size + write + LENGTH_SIZE + sei_size));
+    uint8_t* data = flvtag_payload_data(tag);
+    memmove(&data[insert + LENGTH_SIZE + sei_size], &data[insert], write - insert);
+    data[insert + 0] = sei_size >> 24; // nalu size
+    data[insert + 1] = sei_size >> 16;
+    data[insert + 2] = sei_size >> 8;
+    data[insert + 3] = sei_size >> 0;
+    memcpy(&data[insert + LENGTH_SIZE], sei_data, sei_size);
+    flvtag_updatesize(tag, (uint32_t)(header_size + write + LENGTH_SIZE + sei_size));
+    return 1;
+}
+
 int flvtag_addcaption_text(flvtag_t* tag, const utf8_char_t* text)
 {
     sei_t sei;
@@ -402,19 +448,24 @@ int flvtag_addcaption_text(flvtag_t* tag, const utf8_char_t* text)
     return ret;
 }
 
-int sei_for_n_commands(flvtag_t* tag, cc_data_cmdlist_t* cmdlist, uint16_t* pos, uint16_t count) {
+int flvtag_addcaption_encoder(flvtag_t* tag, caption_encoder_t* enc, const utf8_char_t* text)
+{
+    size_t sei_size;
+    const uint8_t* sei_data = caption_encoder_render(enc, text, caption_encoder_popon, DEFAULT_CHANNEL, &sei_size);
+    return sei_data ? flvtag_addsei_nal(tag, sei_data, sei_size) : 0;
+}
+
+int sei_for_n_commands(flvtag_t* tag, cc_data_cmdlist_t* cmdlist, uint16_t count) {
     sei_t sei;
     cea708_t cea708;
 
-    if (tag == NULL || cmdlist == NULL || pos == NULL) {
+    if (tag == NULL || cmdlist == NULL) {
         return 0;
     }
 
     sei_init(&sei, flvtag_pts(tag));
     cea708_init(&cea708, sei.timestamp);
-    for (uint16_t i = 0; i < count; i++) {
-        cea708_add_from_cmdlist(&cea708, cmdlist, pos);
-    }
+    cea708_drain_cmdlist(&cea708, cmdlist, count);
     sei_append_708(&sei, &cea708);
 
     int ret = flvtag_addsei(tag, &sei);
@@ -422,7 +473,7 @@ int sei_for_n_commands(flvtag_t* tag, cc_data_cmdlist_t* cmdlist, uint16_t* pos,
     return ret;
 }
 
-int sei_for_remaining_commands(flvtag_t* tag, cc_data_cmdlist_t* cmdlist, uint16_t* pos) {
+int sei_for_remaining_commands(flvtag_t* tag, cc_data_cmdlist_t* cmdlist) {
     sei_t sei;
     cea708_t cea708;
 
@@ -433,7 +484,7 @@ int sei_for_remaining_commands(flvtag_t* tag, cc_data_cmdlist_t* cmdlist, uint16
     sei_init(&sei, flvtag_pts(tag));
     cea708_init(&cea708, sei.timestamp);
     if (cmdlist != NULL) {
-        cea708_add_all_from_cmdlist(&cea708, cmdlist, pos);
+        cea708_drain_cmdlist(&cea708, cmdlist, cmdlist->length);
     }
     sei_append_708(&sei, &cea708);
     
@@ -442,6 +493,24 @@ int sei_for_remaining_commands(flvtag_t* tag, cc_data_cmdlist_t* cmdlist, uint16
     return ret;
 }
 
+int sei_for_scheduler(flvtag_t* tag, cc_scheduler_t* sched) {
+    sei_t sei;
+    cea708_t cea708;
+
+    if (tag == NULL || sched == NULL) {
+        return 0;
+    }
+
+    sei_init(&sei, flvtag_pts(tag));
+    cea708_init(&cea708, sei.timestamp);
+    cc_scheduler_frame(sched, &cea708);
+    sei_append_708(&sei, &cea708);
+
+    int ret = flvtag_addsei(tag, &sei);
+    sei_free(&sei);
+    return ret;
+}
+
 int flvtag_addcaption_scc(flvtag_t* tag, const scc_t* scc)
 {
     sei_t sei;
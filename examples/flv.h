@@ -24,6 +24,8 @@
 #ifndef LIBCAPTION_FLV_H
 #define LIBCAPTION_FLV_H
 
+#include "caption_encoder.h"
+#include "cc_scheduler.h"
 #include "mpeg.h"
 #include <inttypes.h>
 #include <stddef.h>
@@ -131,9 +133,13 @@ int flv_write_header(FILE* flv, int has_audio, int has_video);
 sei_t* flv_read_sei(FILE* flv, flvtag_t* tag);
 ////////////////////////////////////////////////////////////////////////////////
 int flvtag_initavc(flvtag_t* tag, uint32_t dts, int32_t cts, flvtag_frametype_t type);
-int flvtag_avcwritenal(flvtag_t* tag, uint8_t* data, size_t size);
+int flvtag_avcwritenal(flvtag_t* tag, const uint8_t* data, size_t size);
+// Inserts a rendered sei NAL unit, such as one from caption_encoder_render, without parsing it
+int flvtag_addsei_nal(flvtag_t* tag, const uint8_t* sei_data, size_t sei_size);
 int flvtag_addcaption_scc(flvtag_t* tag, const scc_t* scc);
 int flvtag_addcaption_text(flvtag_t* tag, const utf8_char_t* text);
+// Same as flvtag_addcaption_text, but reuses the scratch state and cache of enc between frames
+int flvtag_addcaption_encoder(flvtag_t* tag, caption_encoder_t* enc, const utf8_char_t* text);
 ////////////////////////////////////////////////////////////////////////////////
 int flvtag_amfcaption_708(flvtag_t* tag, uint32_t timestamp, sei_message_t* msg);
 ////////////////////////////////////////////////////////////////////////////////
@@ -142,8 +148,11 @@ int flvtag_amfcaption_utf8(flvtag_t* tag, uint32_t timestamp, const utf8_char_t*
 //////////////////////
 
 
-int sei_for_n_commands(flvtag_t* tag, cc_data_cmdlist_t* cmdlist, uint16_t* pos, uint16_t count);
-int sei_for_remaining_commands(flvtag_t* tag, cc_data_cmdlist_t* cmdlist, uint16_t* pos);
+// Both drain the commands they write from the front of cmdlist
+int sei_for_n_commands(flvtag_t* tag, cc_data_cmdlist_t* cmdlist, uint16_t count);
+int sei_for_remaining_commands(flvtag_t* tag, cc_data_cmdlist_t* cmdlist);
+// Adds one frame worth of scheduled commands, sized for the frame rate of sched
+int sei_for_scheduler(flvtag_t* tag, cc_scheduler_t* sched);
 
 typedef struct {
     double timestamp[5];
@@ -30,7 +30,7 @@
 int main(int argc, char** argv)
 {
     flvtag_t tag;
-    srt_t* srt = 0;
+    srt_emitter_t emitter;
     int has_audio, has_video;
     caption_frame_t frame;
     mpeg_bitstream_t mpegbs;
@@ -48,7 +48,7 @@ int main(int argc, char** argv)
     mpeg_bitstream_init(&mpegbs);
 
     FILE* flv = flv_open_read(path);
-    srt = srt_new();
+    srt_emitter_init(&emitter, 1);
 
     if (!flv_read_header(flv, &has_audio, &has_video)) {
         fprintf(stderr, "'%s' Not an flv file\n", path);
@@ -85,15 +85,23 @@ int main(int argc, char** argv)
 
                 case LIBCAPTION_READY: {
                     caption_frame_dump(&frame);
-                    srt_cue_from_caption_frame(&frame, srt);
+                    if (LIBCAPTION_OK != srt_emitter_frame(&emitter, &frame)) {
+                        fprintf(stderr, "Failed to write output\n");
+                        return EXIT_FAILURE;
+                    }
                 } break;
                 } //switch
             }
         }
     }
 
-    srt_dump(srt);
-    srt_free(srt);
+    if (LIBCAPTION_OK != srt_emitter_finish(&emitter)) {
+        fprintf(stderr, "Failed to write output\n");
+        srt_emitter_free(&emitter);
+        return EXIT_FAILURE;
+    }
+
+    srt_emitter_free(&emitter);
 
-    return 1;
+    return EXIT_SUCCESS;
 }
@@ -21,6 +21,7 @@
 /* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
 /* THE SOFTWARE.                                                                              */
 /**********************************************************************************************/
+#include "caption_encoder.h"
 #include "flv.h"
 #include "mpeg.h"
 #include <stdio.h>
@@ -86,8 +87,10 @@ int main(int argc, char** argv)
     FILE* flv = flv_open_read(argv[1]);
     FILE* out = flv_open_write(argv[2]);
     char partyDudes[64];
+    caption_encoder_t encoder;
 
     flvtag_init(&tag);
+    caption_encoder_init(&encoder, 0);
 
     if (!flv_read_header(flv, &has_audio, &has_video)) {
         fprintf(stderr, "%s is not an flv file\n", argv[1]);
@@ -102,7 +105,9 @@ int main(int argc, char** argv)
             get_dudes(partyDudes, nextParty);
 
             if (CAPTION_METHOD == CAPTION_METHOD_SEI_708) {
-                flvtag_addcaption_text(&tag, partyDudes);
+                size_t sei_size;
+                const uint8_t* sei_data = caption_encoder_render(&encoder, partyDudes, caption_encoder_popon, DEFAULT_CHANNEL, &sei_size);
+                flvtag_addsei_nal(&tag, sei_data, sei_size);
             } else if (CAPTION_METHOD == CAPTION_METHOD_AMF_708) {
                 write_amfcaptions_708(out, nextParty, partyDudes);
             } else if (CAPTION_METHOD == CAPTION_METHOD_AMF_UTF8) {
@@ -119,5 +124,6 @@ int main(int argc, char** argv)
         flv_write_tag(out, &tag);
     }
 
+    caption_encoder_free(&encoder);
     return EXIT_SUCCESS;
 }
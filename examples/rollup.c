@@ -63,10 +63,12 @@ int main(int argc, char** argv)
     int i = 0;
     flvtag_t tag;
     srt_t* srt = 0;
+    caption_encoder_t encoder;
     int has_audio, has_video;
     FILE* flv = flv_open_read(argv[1]);
     FILE* out = flv_open_write(argv[2]);
     flvtag_init(&tag);
+    caption_encoder_init(&encoder, 0);
 
     srt = srt_new();
 
@@ -84,12 +86,14 @@ int main(int argc, char** argv)
     while (flv_read_tag(flv, &tag)) {
         if (srt->cue_head && flvtag_avcpackettype_nalu == flvtag_avcpackettype(&tag) && srt->cue_head->timestamp <= flvtag_pts_seconds(&tag)) {
             fprintf(stderr, "%f %s\n", flvtag_pts_seconds(&tag), srt_cue_data(srt->cue_head));
-            flvtag_addcaption_text(&tag, srt_cue_data(srt->cue_head));
+            flvtag_addcaption_encoder(&tag, &encoder, srt_cue_data(srt->cue_head));
             srt_cue_free_head(srt);
         }
 
         flv_write_tag(out, &tag);
     }
 
+    flvtag_free(&tag);
+    caption_encoder_free(&encoder);
     return EXIT_SUCCESS;
 }
@@ -34,8 +34,8 @@ int main(int argc, char** argv)
     size_t scc_size = 0;
     caption_frame_t frame;
     srt_t* srt = 0;
-    utf8_char_t* scc_data_ptr = utf8_load_text_file(argv[1], &scc_size);
-    utf8_char_t* scc_data = scc_data_ptr;
+    const utf8_char_t* scc_data_ptr = utf8_map_text_file(argv[1], &scc_size);
+    const utf8_char_t* scc_data = scc_data_ptr;
 
     srt = srt_new();
     caption_frame_init(&frame);
@@ -54,6 +54,6 @@ int main(int argc, char** argv)
 
     srt_dump(srt);
     srt_free(srt);
-    free(scc_data_ptr);
+    utf8_unmap_text_file(scc_data_ptr, scc_size);
     return EXIT_SUCCESS;
 }
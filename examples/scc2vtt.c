@@ -39,8 +39,8 @@ int main(int argc, char** argv)
     size_t scc_size = 0;
     caption_frame_t frame;
     vtt_t* vtt = 0;
-    utf8_char_t* scc_data_ptr = utf8_load_text_file(argv[1], &scc_size);
-    utf8_char_t* scc_data = scc_data_ptr;
+    const utf8_char_t* scc_data_ptr = utf8_map_text_file(argv[1], &scc_size);
+    const utf8_char_t* scc_data = scc_data_ptr;
 
     vtt = vtt_new();
     caption_frame_init(&frame);
@@ -58,6 +58,6 @@ int main(int argc, char** argv)
 
     vtt_dump(vtt);
     vtt_free(vtt);
-    free(scc_data_ptr);
+    utf8_unmap_text_file(scc_data_ptr, scc_size);
     return EXIT_SUCCESS;
 }
@@ -32,8 +32,8 @@ int main(int argc, char** argv)
     scc_t* scc = NULL;
     size_t scc_size = 0;
     caption_frame_t frame;
-    utf8_char_t* scc_data_ptr = utf8_load_text_file(argv[1], &scc_size);
-    utf8_char_t* scc_data = scc_data_ptr;
+    const utf8_char_t* scc_data_ptr = utf8_map_text_file(argv[1], &scc_size);
+    const utf8_char_t* scc_data = scc_data_ptr;
 
     caption_frame_init(&frame);
     scc_data += scc_to_608(&scc, scc_data);
@@ -51,6 +51,6 @@ int main(int argc, char** argv)
         scc_data += scc_to_608(&scc, scc_data);
     }
 
-    free(scc_data_ptr);
+    utf8_unmap_text_file(scc_data_ptr, scc_size);
     return EXIT_SUCCESS;
 }
@@ -34,7 +34,7 @@ int main(int argc, char** argv)
     }
 
     size_t size;
-    utf8_char_t* data = utf8_load_text_file(argv[1], &size);
+    const utf8_char_t* data = utf8_map_text_file(argv[1], &size);
     if (data == NULL) {
         fprintf(stderr, "Failed to load input file\n");
         return 1;
@@ -43,4 +43,5 @@ int main(int argc, char** argv)
     srt_t* head = srt_parse(data, size);
     vtt_dump(head);
     srt_free(head);
+    utf8_unmap_text_file(data, size);
 }
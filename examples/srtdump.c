@@ -60,7 +60,7 @@ int main(int argc, char** argv)
     }
 
     size_t size;
-    utf8_char_t* data = utf8_load_text_file(argv[1], &size);
+    const utf8_char_t* data = utf8_map_text_file(argv[1], &size);
     srt = srt_parse(data, size);
 
     for (cue = srt->cue_head; cue; cue = cue->next) {
@@ -70,4 +70,5 @@ int main(int argc, char** argv)
     }
 
     srt_free(srt);
+    utf8_unmap_text_file(data, size);
 }
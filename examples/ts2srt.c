@@ -32,8 +32,7 @@ int main(int argc, char** argv)
     const char* path = argv[1];
 
     ts_t ts;
-    srt_t* srt = 0;
-    // srt_cue_t, *cue;
+    srt_emitter_t emitter;
     mpeg_bitstream_t mpegbs;
     caption_frame_t frame;
     uint8_t pkt[TS_PACKET_SIZE];
@@ -43,7 +42,7 @@ int main(int argc, char** argv)
     caption_frame_init(&frame);
     mpeg_bitstream_init(&mpegbs);
 
-    srt = srt_new();
+    srt_emitter_init(&emitter, 1);
     FILE* file = (0 == strcmp("-", path)) ? freopen(NULL, "rb", stdin) : fopen(path, "rb");
     if(!file) {
         fprintf(stderr,"Failed to open input\n");
@@ -74,7 +73,10 @@ int main(int argc, char** argv)
 
                 case LIBCAPTION_READY: {
                     // caption_frame_dump(&frame);
-                    srt_cue_from_caption_frame(&frame, srt);
+                    if (LIBCAPTION_OK != srt_emitter_frame(&emitter, &frame)) {
+                        fprintf(stderr, "Failed to write output\n");
+                        return EXIT_FAILURE;
+                    }
                 } break;
                 } //switch
             } // while
@@ -83,13 +85,19 @@ int main(int argc, char** argv)
 
     // Flush anything left
     while (mpeg_bitstream_flush(&mpegbs, &frame, &dtvcc, &dtvcc_pos)) {
-        if (mpeg_bitstream_status(&mpegbs)) {
-            srt_cue_from_caption_frame(&frame, srt);
+        if (mpeg_bitstream_status(&mpegbs) && LIBCAPTION_OK != srt_emitter_frame(&emitter, &frame)) {
+            fprintf(stderr, "Failed to write output\n");
+            return EXIT_FAILURE;
         }
     }
 
-    srt_dump(srt);
-    srt_free(srt);
+    if (LIBCAPTION_OK != srt_emitter_finish(&emitter)) {
+        fprintf(stderr, "Failed to write output\n");
+        srt_emitter_free(&emitter);
+        return EXIT_FAILURE;
+    }
+
+    srt_emitter_free(&emitter);
 
     return EXIT_SUCCESS;
 }
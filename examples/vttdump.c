@@ -35,7 +35,7 @@ int main(int argc, char** argv)
     }
 
     size_t size;
-    utf8_char_t* data = utf8_load_text_file(argv[1], &size);
+    const utf8_char_t* data = utf8_map_text_file(argv[1], &size);
 
     vtt_t* vtt = vtt_parse(data, size);
 
@@ -46,4 +46,5 @@ int main(int argc, char** argv)
     }
 
     vtt_free(vtt);
+    utf8_unmap_text_file(data, size);
 }
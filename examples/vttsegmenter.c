@@ -25,62 +25,176 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-// #include "sei.h"
+#if defined(VTTSEGMENTER_THREADS)
+#include <pthread.h>
+#endif
 
-#define MAX_VTT_SIZE (10 * 1024 * 1024)
-#define MAX_READ_SIZE 4096
+#define WRITER_THREADS 4
+#define WRITER_QUEUE_SIZE 32
 
-void vtt_write_header(FILE* vttFile)
+////////////////////////////////////////////////////////////////////////////////
+// Segments are written by a small pool of threads. The header bytes are rendered once and
+// shared, each job owns its file name and body.
+typedef struct {
+    char* filename;
+    utf8_char_t* body;
+    size_t size;
+} segment_job_t;
+
+typedef struct {
+    const vtt_writer_t* header;
+    int failed;
+#if defined(VTTSEGMENTER_THREADS)
+    int done;
+    size_t head, count;
+    segment_job_t queue[WRITER_QUEUE_SIZE];
+    pthread_mutex_t mutex;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    pthread_t threads[WRITER_THREADS];
+    int thread_count;
+#endif
+} writer_pool_t;
+
+static int segment_job_write(const vtt_writer_t* header, segment_job_t* job)
 {
-    fprintf(vttFile, "WEBVTT\r\n\r\n");
+    int ok = 0;
+    FILE* outputFile = fopen(job->filename, "wb");
+
+    if (outputFile == NULL) {
+        fprintf(stderr, "Failed to open output file for writing: '%s'\n", job->filename);
+    } else {
+        ok = header->size == fwrite(header->data, 1, header->size, outputFile);
+        ok = ok && (0 == job->size || job->size == fwrite(job->body, 1, job->size, outputFile));
+        ok = (0 == fclose(outputFile)) && ok;
+    }
+
+    free(job->filename);
+    free(job->body);
+    return ok;
 }
 
-void vtt_write_block(vtt_block_t* block, FILE* vttFile)
+#if defined(VTTSEGMENTER_THREADS)
+static void* writer_pool_thread(void* arg)
 {
-    switch (block->type) {
-    case VTT_REGION:
-        fprintf(vttFile, "REGION\r\n%s\r\n\r\n", vtt_block_data(block));
-        break;
-    case VTT_STYLE:
-        fprintf(vttFile, "STYLE\r\n%s\r\n\r\n", vtt_block_data(block));
-        break;
-    case VTT_NOTE:
-        fprintf(vttFile, "NOTE\r\n%s\r\n\r\n", vtt_block_data(block));
-        break;
-    case VTT_CUE: {
-        if (block->cue_id != NULL) {
-            fprintf(vttFile, "%s\r\n", block->cue_id);
+    writer_pool_t* pool = (writer_pool_t*)arg;
+    segment_job_t job;
+
+    for (;;) {
+        pthread_mutex_lock(&pool->mutex);
+
+        while (0 == pool->count && !pool->done) {
+            pthread_cond_wait(&pool->not_empty, &pool->mutex);
         }
 
-        int hh1, hh2, mm1, mm2, ss1, ss2, ms1, ms2;
-        vtt_crack_time(block->timestamp, &hh1, &mm1, &ss1, &ms1);
-        vtt_crack_time(block->timestamp + block->duration, &hh2, &mm2, &ss2, &ms2);
+        if (0 == pool->count) {
+            pthread_mutex_unlock(&pool->mutex);
+            return NULL;
+        }
+
+        job = pool->queue[pool->head];
+        pool->head = (pool->head + 1) % WRITER_QUEUE_SIZE;
+        pool->count -= 1;
+        pthread_cond_signal(&pool->not_full);
+        pthread_mutex_unlock(&pool->mutex);
+
+        if (!segment_job_write(pool->header, &job)) {
+            pthread_mutex_lock(&pool->mutex);
+            pool->failed = 1;
+            pthread_mutex_unlock(&pool->mutex);
+        }
+    }
+}
+#endif
+
+static void writer_pool_init(writer_pool_t* pool, const vtt_writer_t* header)
+{
+    memset(pool, 0, sizeof(writer_pool_t));
+    pool->header = header;
+#if defined(VTTSEGMENTER_THREADS)
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->not_empty, NULL);
+    pthread_cond_init(&pool->not_full, NULL);
+
+    // Only threads that actually started are joined, with none the segments are written inline
+    while (pool->thread_count < WRITER_THREADS
+        && 0 == pthread_create(&pool->threads[pool->thread_count], NULL, writer_pool_thread, pool)) {
+        pool->thread_count += 1;
+    }
+#endif
+}
 
-        fprintf(vttFile, "%d:%02d:%02d.%03d --> %02d:%02d:%02d.%03d",
-            hh1, mm1, ss1, ms1, hh2, mm2, ss2, ms2);
+// Takes ownership of the job
+static void writer_pool_submit(writer_pool_t* pool, segment_job_t* job)
+{
+#if defined(VTTSEGMENTER_THREADS)
+    if (0 < pool->thread_count) {
+        pthread_mutex_lock(&pool->mutex);
 
-        if (block->cue_settings != NULL) {
-            printf(" %s", block->cue_settings);
+        while (WRITER_QUEUE_SIZE == pool->count) {
+            pthread_cond_wait(&pool->not_full, &pool->mutex);
         }
 
-        fprintf(vttFile, "\r\n%s\r\n\r\n", vtt_block_data(block));
-    } break;
+        pool->queue[(pool->head + pool->count) % WRITER_QUEUE_SIZE] = (*job);
+        pool->count += 1;
+        pthread_cond_signal(&pool->not_empty);
+        pthread_mutex_unlock(&pool->mutex);
+        return;
+    }
+#endif
+    if (!segment_job_write(pool->header, job)) {
+        pool->failed = 1;
     }
 }
 
+// Waits for every submitted segment, returns 0 if any could not be written
+static int writer_pool_finish(writer_pool_t* pool)
+{
+#if defined(VTTSEGMENTER_THREADS)
+    pthread_mutex_lock(&pool->mutex);
+    pool->done = 1;
+    pthread_cond_broadcast(&pool->not_empty);
+    pthread_mutex_unlock(&pool->mutex);
+
+    for (int i = 0; i < pool->thread_count; ++i) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->not_full);
+    pthread_cond_destroy(&pool->not_empty);
+    pthread_mutex_destroy(&pool->mutex);
+#endif
+    return !pool->failed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+typedef struct {
+    const vtt_index_entry_t* entry;
+    size_t size; // bytes of the rendered cue
+} active_cue_t;
+
+static const char* path_basename(const char* path)
+{
+    const char* name = strrchr(path, '/');
+    return name ? name + 1 : path;
+}
+
 /**
- * vttsegmenter filename.vtt segment_size duration output_pattern_%05d.vtt
+ * vttsegmenter filename.vtt segment_size duration output_pattern_%05d.vtt [playlist.m3u8]
+ *
+ * Sweeps the cues once in start time order. A cue is rendered when the first segment it
+ * overlaps is reached, copied into every segment it overlaps, and dropped once it has ended.
  */
 int main(int argc, char** argv)
 {
-    if (argc != 5) {
-        fprintf(stderr, "Usage: vttsegmenter filename.vtt segment_size duration output%%05d.vtt\n");
+    if (argc != 5 && argc != 6) {
+        fprintf(stderr, "Usage: vttsegmenter filename.vtt segment_size duration output%%05d.vtt [playlist.m3u8]\n");
         return 0;
     }
 
     double segment_size;
     double duration;
-    if (1 != sscanf(argv[2], "%lf", &segment_size)) {
+    if (1 != sscanf(argv[2], "%lf", &segment_size) || 0 >= segment_size) {
         return 1;
     }
     if (1 != sscanf(argv[3], "%lf", &duration)) {
@@ -88,7 +202,7 @@ int main(int argc, char** argv)
     }
 
     size_t size;
-    utf8_char_t* data = utf8_load_text_file(argv[1], &size);
+    const utf8_char_t* data = utf8_map_text_file(argv[1], &size);
     if (data == NULL) {
         fprintf(stderr, "Failed to load input file\n");
         return 1;
@@ -99,46 +213,127 @@ int main(int argc, char** argv)
         return 1;
     }
 
+    vtt_index_t index;
+    if (LIBCAPTION_OK != vtt_index_init(&index, vtt)) {
+        fprintf(stderr, "Failed to index vtt\n");
+        return 1;
+    }
+
+    // Every segment starts with the same bytes
+    vtt_writer_t header;
+    vtt_writer_init(&header, -1, 0);
+
+    if (LIBCAPTION_OK != vtt_writer_header(&header, vtt)) {
+        fprintf(stderr, "Failed to render vtt header\n");
+        return 1;
+    }
+
+    FILE* playlist = NULL;
+    if (6 == argc) {
+        if (NULL == (playlist = fopen(argv[5], "w"))) {
+            fprintf(stderr, "Failed to open playlist for writing: '%s'\n", argv[5]);
+            return 1;
+        }
+
+        fprintf(playlist, "#EXTM3U\n#EXT-X-VERSION:3\n#EXT-X-TARGETDURATION:%d\n#EXT-X-MEDIA-SEQUENCE:0\n#EXT-X-PLAYLIST-TYPE:VOD\n",
+            (int)(segment_size + 0.999));
+    }
+
+    active_cue_t* active = malloc((index.count ? index.count : 1) * sizeof(active_cue_t));
+    if (active == NULL) {
+        fprintf(stderr, "Failed to allocate active cues\n");
+        return 1;
+    }
+
+    // The active cues, rendered back to back in start time order
+    vtt_writer_t rendered;
+    vtt_writer_init(&rendered, -1, 0);
+
+    writer_pool_t pool;
+    writer_pool_init(&pool, &header);
+
+    size_t next = 0, active_count = 0, i, j, k, read, write;
     char filename[1024];
+    int ret = 0;
+
+    for (i = 0; i * segment_size < duration; i++) {
+        double segment_start = i * segment_size;
+        double segment_end = (i + 1) * segment_size;
 
-    for (int i = 0; i * segment_size < duration; i++) {
-        if (snprintf(filename, 1024, argv[4], i) < 0) {
+        if (snprintf(filename, 1024, argv[4], (int)i) < 0) {
             fprintf(stderr, "Invalid filename pattern for output\n");
-            return 1;
+            ret = 1;
+            break;
         }
 
-        FILE* outputFile = fopen(filename, "w");
-        if (outputFile == NULL) {
-            fprintf(stderr, "Failed to open output file for reading: '%s'\n", filename);
-            return 1;
+        // Drop the cues that ended before this segment, moving the text of the others down
+        for (j = k = 0, read = write = 0; j < active_count; read += active[j++].size) {
+            if (active[j].entry->end > segment_start) {
+                if (write != read) {
+                    memmove(rendered.data + write, rendered.data + read, active[j].size);
+                }
+
+                write += active[j].size;
+                active[k++] = active[j];
+            }
         }
 
-        vtt_write_header(outputFile);
-        vtt_block_t* region = vtt->region_head;
-        while (region != NULL) {
-            vtt_write_block(region, outputFile);
-            region = region->next;
+        active_count = k;
+        rendered.size = write;
+
+        // Render the cues that start in this segment
+        for (; next < index.count && index.entries[next].start < segment_end; ++next) {
+            if (index.entries[next].end > segment_start) {
+                size_t size = rendered.size;
+
+                if (LIBCAPTION_OK != vtt_writer_cue(&rendered, index.entries[next].cue)) {
+                    ret = 1;
+                    break;
+                }
+
+                active[active_count].entry = &index.entries[next];
+                active[active_count].size = rendered.size - size;
+                active_count += 1;
+            }
         }
 
-        vtt_block_t* style = vtt->style_head;
-        while (style != NULL) {
-            vtt_write_block(style, outputFile);
-            style = style->next;
+        // The rendered text is now exactly the body of this segment
+        segment_job_t job = { strdup(filename), malloc(rendered.size ? rendered.size : 1), rendered.size };
+
+        if (ret || job.filename == NULL || job.body == NULL) {
+            fprintf(stderr, "Failed to build segment: '%s'\n", filename);
+            free(job.filename);
+            free(job.body);
+            ret = 1;
+            break;
         }
 
-        double segment_start = i * segment_size;
-        double segment_end = (i + 1) * segment_size;
+        if (rendered.size) {
+            memcpy(job.body, rendered.data, rendered.size);
+        }
 
-        vtt_block_t* cue = vtt->cue_head;
-        while (cue != NULL) {
-            if ((cue->timestamp < segment_end) && ((cue->timestamp + cue->duration) > segment_start)) {
-                vtt_write_block(cue, outputFile);
-            }
-            cue = cue->next;
+        writer_pool_submit(&pool, &job);
+
+        if (playlist) {
+            double extinf = duration < segment_end ? duration - segment_start : segment_size;
+            fprintf(playlist, "#EXTINF:%.3f,\n%s\n", extinf, path_basename(filename));
         }
+    }
+
+    if (!writer_pool_finish(&pool)) {
+        ret = 1;
+    }
 
-        fclose(outputFile);
+    if (playlist) {
+        fprintf(playlist, "#EXT-X-ENDLIST\n");
+        fclose(playlist);
     }
 
+    free(active);
+    vtt_writer_free(&rendered);
+    vtt_writer_free(&header);
+    vtt_index_free(&index);
     vtt_free(vtt);
+    utf8_unmap_text_file(data, size);
+    return ret;
 }
@@ -0,0 +1,188 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "caption_encoder.h"
+#include "caption_frame.h"
+#include "eia608.h"
+#include "mpeg.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+void caption_encoder_init(caption_encoder_t* enc, size_t capacity)
+{
+    memset(enc, 0, sizeof(caption_encoder_t));
+    enc->capacity = capacity ? capacity : CAPTION_ENCODER_DEFAULT_CAPACITY;
+    enc->entries = (caption_encoder_entry_t*)calloc(enc->capacity, sizeof(caption_encoder_entry_t));
+    enc->capacity = enc->entries ? enc->capacity : 0;
+}
+
+void caption_encoder_free(caption_encoder_t* enc)
+{
+    size_t i;
+
+    for (i = 0; i < enc->capacity; ++i) {
+        free(enc->entries[i].text);
+        free(enc->entries[i].data);
+    }
+
+    free(enc->entries);
+    cmdlist_free(&enc->cmdlist);
+    memset(enc, 0, sizeof(caption_encoder_t));
+}
+
+static uint64_t caption_encoder_hash(const utf8_char_t* text, caption_encoder_mode_t mode, int channel)
+{
+    uint64_t h = 0xcbf29ce484222325ULL; // FNV-1a
+    h = (h ^ (uint8_t)mode) * 0x100000001b3ULL;
+    h = (h ^ (uint8_t)channel) * 0x100000001b3ULL;
+    h = (h ^ (text ? 1 : 0)) * 0x100000001b3ULL;
+
+    for (; text && *text; ++text) {
+        h = (h ^ (uint8_t)*text) * 0x100000001b3ULL;
+    }
+
+    return h ? h : 1; // 0 marks an unused entry
+}
+
+static int caption_encoder_match(const caption_encoder_entry_t* entry, uint64_t hash, const utf8_char_t* text, caption_encoder_mode_t mode, int channel)
+{
+    if (entry->hash != hash || entry->mode != mode || entry->channel != channel) {
+        return 0;
+    }
+
+    return text ? (!entry->clear && 0 == strcmp(entry->text, text)) : entry->clear;
+}
+
+// Grows a buffer, never shrinks it, so a warm cache stops allocating
+static libcaption_stauts_t caption_encoder_reserve(void** data, size_t* capacity, size_t size)
+{
+    void* new_data;
+
+    if (size <= (*capacity)) {
+        return LIBCAPTION_OK;
+    }
+
+    size = size < 2 * (*capacity) ? 2 * (*capacity) : size;
+
+    if (!(new_data = realloc(*data, size))) {
+        return LIBCAPTION_ERROR;
+    }
+
+    (*data) = new_data;
+    (*capacity) = size;
+    return LIBCAPTION_OK;
+}
+
+static libcaption_stauts_t caption_encoder_encode(caption_encoder_t* enc, caption_encoder_entry_t* entry)
+{
+    int i;
+    size_t payload_size, size = 1; // nalu_type
+    uint8_t payload[CEA608_MAX_SIZE];
+
+    if (entry->clear) {
+        cmdlist_from_caption_clear(&enc->cmdlist);
+    } else if (caption_encoder_rollup == entry->mode) {
+        cmdlist_from_streaming_text(&enc->cmdlist, entry->text);
+    } else {
+        caption_frame_from_text(&enc->frame, entry->text);
+        commands_for_frame(&enc->cmdlist, &enc->frame);
+    }
+
+    while (0 < enc->cmdlist.length) {
+        cea708_init(&enc->cea708, 0);
+        cea708_drain_cmdlist(&enc->cea708, &enc->cmdlist, enc->cmdlist.length);
+
+        for (i = 0; i < enc->cea708.user_data.cc_count; ++i) {
+            enc->cea708.user_data.cc_data[i].cc_data = eia608_set_channel(enc->cea708.user_data.cc_data[i].cc_data, entry->channel);
+        }
+
+        payload_size = cea708_render(&enc->cea708, &payload[0], sizeof(payload));
+
+        // + 1 for the stop bit
+        if (LIBCAPTION_OK != caption_encoder_reserve((void**)&entry->data, &entry->data_capacity, size + sei_message_render_size(sei_type_user_data_registered_itu_t_t35, payload_size) + 1)) {
+            cmdlist_clear(&enc->cmdlist);
+            return LIBCAPTION_ERROR;
+        }
+
+        size += sei_message_render(sei_type_user_data_registered_itu_t_t35, &payload[0], payload_size, &entry->data[size]);
+    }
+
+    if (1 == size) { // nothing to render
+        return LIBCAPTION_ERROR;
+    }
+
+    entry->data[0] = 6;
+    entry->data[size++] = 0x80;
+    entry->size = size;
+    return LIBCAPTION_OK;
+}
+
+const uint8_t* caption_encoder_render(caption_encoder_t* enc, const utf8_char_t* text, caption_encoder_mode_t mode, int channel, size_t* size)
+{
+    size_t i;
+    uint64_t hash;
+    caption_encoder_entry_t *entry = 0, *lru;
+
+    if (!enc || !size || !enc->capacity) {
+        return NULL;
+    }
+
+    hash = caption_encoder_hash(text, mode, channel);
+
+    for (i = 0, lru = &enc->entries[0]; i < enc->capacity && !entry; ++i) {
+        if (caption_encoder_match(&enc->entries[i], hash, text, mode, channel)) {
+            entry = &enc->entries[i];
+        } else if (enc->entries[i].used < lru->used) {
+            lru = &enc->entries[i];
+        }
+    }
+
+    if (!entry) {
+        entry = lru;
+        entry->hash = entry->used = 0;
+
+        if (text) {
+            size_t bytes = strlen(text) + 1;
+            if (LIBCAPTION_OK != caption_encoder_reserve((void**)&entry->text, &entry->text_capacity, bytes)) {
+                return NULL;
+            }
+
+            memcpy(entry->text, text, bytes);
+        }
+
+        entry->clear = !text;
+        entry->hash = hash;
+        entry->mode = mode;
+        entry->channel = channel;
+
+        if (LIBCAPTION_OK != caption_encoder_encode(enc, entry)) {
+            entry->hash = entry->used = 0;
+            return NULL;
+        }
+    }
+
+    entry->used = ++enc->clock;
+    (*size) = entry->size;
+    return entry->data;
+}
@@ -22,6 +22,7 @@
 /* THE SOFTWARE.                                                                              */
 /**********************************************************************************************/
 #include "caption_frame.h"
+#include "caption_publisher.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -40,7 +41,7 @@ void caption_frame_state_clear(caption_frame_t* frame)
 {
     frame->write = 0;
     frame->timestamp = -1;
-    frame->state = (caption_frame_state_t){ 0, 0, 0, SCREEN_ROWS - 1, 0, 0 }; // clear global state
+    frame->state = (caption_frame_state_t){ 0, 0, 0, 0, SCREEN_ROWS - 1, 0, 0 }; // clear global state
 }
 
 void caption_frame_init(caption_frame_t* frame)
@@ -49,9 +50,95 @@ void caption_frame_init(caption_frame_t* frame)
     caption_frame_state_clear(frame);
     caption_frame_buffer_clear(&frame->back);
     caption_frame_buffer_clear(&frame->front);
+    frame->text.dirty = CAPTION_FRAME_ALL_ROWS;
+    memset(&frame->coalesce, 0, sizeof(caption_frame_coalesce_t));
+    frame->coalesce.last = -1;
+    frame->publisher = 0;
+}
+
+void caption_frame_set_coalesce(caption_frame_t* frame, int policy, double interval)
+{
+    frame->coalesce.policy = policy;
+    frame->coalesce.interval = interval;
+    frame->coalesce.row_done = frame->coalesce.display = 0;
 }
 ////////////////////////////////////////////////////////////////////////////////
 // Helpers
+static inline void caption_frame_touch(caption_frame_t* frame, caption_frame_buffer_t* buff, int row)
+{
+    if (buff == &frame->front) {
+        frame->text.dirty |= (1 << row);
+    }
+}
+
+static void caption_frame_clear(caption_frame_t* frame, caption_frame_buffer_t* buff)
+{
+    caption_frame_buffer_clear(buff);
+
+    if (buff == &frame->front) {
+        frame->text.dirty = CAPTION_FRAME_ALL_ROWS;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Hashing
+// Column dependent hash of a single cell, empty cells hash to 0
+static uint64_t caption_frame_cell_hash(int col, const caption_frame_cell_t* cell)
+{
+    int i;
+    uint64_t h = 0xcbf29ce484222325ULL; // FNV-1a
+
+    if (0 == cell->data[0]) {
+        return 0;
+    }
+
+    h = (h ^ (uint8_t)col) * 0x100000001b3ULL;
+    h = (h ^ (uint8_t)((cell->sty << 1) | cell->uln)) * 0x100000001b3ULL;
+
+    for (i = 0; i < 4 && cell->data[i]; ++i) {
+        h = (h ^ (uint8_t)cell->data[i]) * 0x100000001b3ULL;
+    }
+
+    return h;
+}
+
+// Binds a row hash to its row number, so rows can move without rehashing their cells
+static uint64_t caption_frame_row_mix(uint64_t h, int row)
+{
+    if (0 == h) {
+        return 0;
+    }
+
+    h += 0x9e3779b97f4a7c15ULL * (uint64_t)(row + 1); // splitmix64
+    h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+    return h ^ (h >> 31);
+}
+
+static void caption_frame_buffer_rehash_row(caption_frame_buffer_t* buff, int row, uint64_t row_hash)
+{
+    buff->hash ^= caption_frame_row_mix(buff->row_hash[row], row) ^ caption_frame_row_mix(row_hash, row);
+    buff->row_hash[row] = row_hash;
+}
+
+static void caption_frame_buffer_rehash(caption_frame_buffer_t* buff)
+{
+    int r;
+
+    for (buff->hash = 0, r = 0; r < SCREEN_ROWS; ++r) {
+        buff->hash ^= caption_frame_row_mix(buff->row_hash[r], r);
+    }
+}
+
+// Moves the cached text of a row along with its cells so roll-up does not force a re-render
+static void caption_frame_text_move(caption_frame_t* frame, int dst, int src)
+{
+    caption_frame_text_t* text = &frame->text;
+    memcpy(&text->data[dst][0], &text->data[src][0], text->size[src] + 1);
+    text->size[dst] = text->size[src];
+    text->dirty = (text->dirty & ~(1 << dst)) | (((text->dirty >> src) & 1) << dst);
+}
+
 static caption_frame_cell_t* frame_buffer_cell(caption_frame_buffer_t* buff, int row, int col)
 {
     if (!buff || 0 > row || SCREEN_ROWS <= row || 0 > col || SCREEN_COLS <= col) {
@@ -61,22 +148,33 @@ static caption_frame_cell_t* frame_buffer_cell(caption_frame_buffer_t* buff, int
     return &buff->cell[row][col];
 }
 
-uint16_t _eia608_from_utf8(const char* s); // function is in eia608.c.re2c
 int caption_frame_write_char(caption_frame_t* frame, int row, int col, eia608_style_t style, int underline, const char* c)
 {
-    if (!frame->write || !_eia608_from_utf8(c)) {
+    if (!frame->write || (c[0] && !_eia608_from_utf8(c))) {
         return 0;
     }
 
     caption_frame_cell_t* cell = frame_buffer_cell(frame->write, row, col);
 
-    if (cell && utf8_char_copy(&cell->data[0], c)) {
+    if (!cell) {
+        return 0;
+    }
+
+    uint64_t row_hash = frame->write->row_hash[row] ^ caption_frame_cell_hash(col, cell);
+
+    if (0 == c[0]) {
+        // EIA608_CHAR_NULL clears the cell (backspace, delete to end of row)
+        memset(cell, 0, sizeof(caption_frame_cell_t));
+    } else if (utf8_char_copy(&cell->data[0], c)) {
         cell->uln = underline;
         cell->sty = style;
-        return 1;
+    } else {
+        return 0;
     }
 
-    return 0;
+    caption_frame_buffer_rehash_row(frame->write, row, row_hash ^ caption_frame_cell_hash(col, cell));
+    caption_frame_touch(frame, frame->write, row);
+    return 1;
 }
 
 const utf8_char_t* caption_frame_read_char(caption_frame_t* frame, int row, int col, eia608_style_t* style, int* underline)
@@ -109,6 +207,33 @@ const utf8_char_t* caption_frame_read_char(caption_frame_t* frame, int row, int
 
 ////////////////////////////////////////////////////////////////////////////////
 // Parsing
+// Moves rows r..SCREEN_ROWS-1 up by one and clears the bottom row
+static void caption_frame_scroll(caption_frame_t* frame, int r)
+{
+    for (; r < SCREEN_ROWS; ++r) {
+        uint8_t* dst = (uint8_t*)frame_buffer_cell(frame->write, r - 1, 0);
+        uint8_t* src = (uint8_t*)frame_buffer_cell(frame->write, r - 0, 0);
+        memcpy(dst, src, sizeof(caption_frame_cell_t) * SCREEN_COLS);
+        frame->write->row_hash[r - 1] = frame->write->row_hash[r];
+
+        if (frame->write == &frame->front) {
+            caption_frame_text_move(frame, r - 1, r);
+        }
+    }
+
+    frame->state.col = 0;
+    caption_frame_cell_t* cell = frame_buffer_cell(frame->write, SCREEN_ROWS - 1, 0);
+    memset(cell, 0, sizeof(caption_frame_cell_t) * SCREEN_COLS);
+    frame->write->row_hash[SCREEN_ROWS - 1] = 0;
+    caption_frame_buffer_rehash(frame->write);
+
+    if (frame->write == &frame->front) {
+        frame->text.size[SCREEN_ROWS - 1] = 0;
+        frame->text.data[SCREEN_ROWS - 1][0] = '\0';
+        frame->text.dirty &= ~(1 << (SCREEN_ROWS - 1));
+    }
+}
+
 libcaption_stauts_t caption_frame_carriage_return(caption_frame_t* frame)
 {
     if (0 > frame->state.row || SCREEN_ROWS <= frame->state.row) {
@@ -121,17 +246,45 @@ libcaption_stauts_t caption_frame_carriage_return(caption_frame_t* frame)
         return LIBCAPTION_OK;
     }
 
-    for (; r < SCREEN_ROWS; ++r) {
-        uint8_t* dst = (uint8_t*)frame_buffer_cell(frame->write, r - 1, 0);
-        uint8_t* src = (uint8_t*)frame_buffer_cell(frame->write, r - 0, 0);
-        memcpy(dst, src, sizeof(caption_frame_cell_t) * SCREEN_COLS);
+    caption_frame_scroll(frame, r);
+    return LIBCAPTION_OK;
+}
+
+// Text services use the whole screen, new rows are added at the bottom once it is full
+libcaption_stauts_t caption_frame_text_newline(caption_frame_t* frame)
+{
+    if (!frame->write || 0 > frame->state.row) {
+        return LIBCAPTION_OK;
     }
 
     frame->state.col = 0;
-    caption_frame_cell_t* cell = frame_buffer_cell(frame->write, SCREEN_ROWS - 1, 0);
-    memset(cell, 0, sizeof(caption_frame_cell_t) * SCREEN_COLS);
+
+    if (SCREEN_ROWS - 1 > frame->state.row) {
+        frame->state.row += 1;
+    } else {
+        frame->state.row = SCREEN_ROWS - 1;
+        caption_frame_scroll(frame, 1);
+    }
+
     return LIBCAPTION_OK;
 }
+
+libcaption_stauts_t caption_frame_text_resume(caption_frame_t* frame, int restart)
+{
+    if (restart || !frame->write) {
+        frame->state.row = 0;
+        frame->state.col = 0;
+    }
+
+    if (restart) {
+        caption_frame_clear(frame, &frame->front);
+    }
+
+    frame->state.rup = 0;
+    frame->write = &frame->front;
+    return restart ? LIBCAPTION_READY : LIBCAPTION_OK;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 libcaption_stauts_t eia608_write_char(caption_frame_t* frame, char* c)
 {
@@ -147,6 +300,7 @@ libcaption_stauts_t eia608_write_char(caption_frame_t* frame, char* c)
 libcaption_stauts_t caption_frame_end(caption_frame_t* frame)
 {
     memcpy(&frame->front, &frame->back, sizeof(caption_frame_buffer_t));
+    frame->text.dirty = CAPTION_FRAME_ALL_ROWS;
     caption_frame_buffer_clear(&frame->back); // This is required
     return LIBCAPTION_READY;
 }
@@ -157,6 +311,7 @@ libcaption_stauts_t caption_frame_decode_preamble(caption_frame_t* frame, uint16
     int row, col, chn, uln;
 
     if (eia608_parse_preamble(cc_data, &row, &col, &sty, &chn, &uln)) {
+        frame->coalesce.row_done |= (row != frame->state.row);
         frame->state.row = row;
         frame->state.col = col;
         frame->state.sty = sty;
@@ -216,7 +371,8 @@ libcaption_stauts_t caption_frame_decode_control(caption_frame_t* frame, uint16_
         return LIBCAPTION_OK;
 
     case eia608_control_erase_display_memory:
-        caption_frame_buffer_clear(&frame->front);
+        caption_frame_clear(frame, &frame->front);
+        frame->coalesce.display = 1;
         return LIBCAPTION_READY;
 
     // ROLL-UP
@@ -236,7 +392,8 @@ libcaption_stauts_t caption_frame_decode_control(caption_frame_t* frame, uint16_
         return LIBCAPTION_OK;
 
     case eia608_control_carriage_return:
-        return caption_frame_carriage_return(frame);
+        frame->coalesce.row_done = 1;
+        return frame->state.txt ? caption_frame_text_newline(frame) : caption_frame_carriage_return(frame);
 
     // Corrections (Is this only valid as part of paint on?)
     case eia608_control_backspace:
@@ -251,10 +408,11 @@ libcaption_stauts_t caption_frame_decode_control(caption_frame_t* frame, uint16_
         return LIBCAPTION_OK;
 
     case eia608_control_erase_non_displayed_memory:
-        caption_frame_buffer_clear(&frame->back);
+        caption_frame_clear(frame, &frame->back);
         return LIBCAPTION_OK;
 
     case eia608_control_end_of_caption:
+        frame->coalesce.display = 1;
         return caption_frame_end(frame);
 
     // cursor positioning
@@ -265,12 +423,18 @@ libcaption_stauts_t caption_frame_decode_control(caption_frame_t* frame, uint16_
         frame->state.col += (cmd - eia608_tab_offset_0);
         return LIBCAPTION_OK;
 
+    // TEXT
+    case eia608_control_text_restart:
+        frame->coalesce.display = frame->state.txt;
+        return frame->state.txt ? caption_frame_text_resume(frame, 1) : LIBCAPTION_OK;
+
+    case eia608_control_text_resume_text_display:
+        return frame->state.txt ? caption_frame_text_resume(frame, 0) : LIBCAPTION_OK;
+
     // Unhandled
     default:
     case eia608_control_alarm_off:
     case eia608_control_alarm_on:
-    case eia608_control_text_restart:
-    case eia608_control_text_resume_text_display:
         return LIBCAPTION_OK;
     }
 }
@@ -297,14 +461,14 @@ libcaption_stauts_t caption_frame_decode_text(caption_frame_t* frame, uint16_t c
     return LIBCAPTION_OK;
 }
 
-libcaption_stauts_t caption_frame_decode(caption_frame_t* frame, uint16_t cc_data, double timestamp)
+static libcaption_stauts_t caption_frame_decode_cc(caption_frame_t* frame, uint16_t cc_data, eia608_class_t cls, double timestamp)
 {
-    if (!eia608_parity_varify(cc_data)) {
+    if (eia608_class_invalid == cls) {
         frame->status = LIBCAPTION_ERROR;
         return frame->status;
     }
 
-    if (eia608_is_padding(cc_data)) {
+    if (eia608_class_padding == cls) {
         frame->status = LIBCAPTION_OK;
         return frame->status;
     }
@@ -315,7 +479,7 @@ libcaption_stauts_t caption_frame_decode(caption_frame_t* frame, uint16_t cc_dat
     }
 
     // skip duplicate controll commands. We also skip duplicate specialna to match the behaviour of iOS/vlc
-    if ((eia608_is_specialna(cc_data) || eia608_is_control(cc_data)) && cc_data == frame->state.cc_data) {
+    if ((eia608_class_specialna == cls || eia608_class_control == cls) && cc_data == frame->state.cc_data) {
         frame->status = LIBCAPTION_OK;
         return frame->status;
     }
@@ -324,12 +488,21 @@ libcaption_stauts_t caption_frame_decode(caption_frame_t* frame, uint16_t cc_dat
 
     if (frame->xds.state) {
         frame->status = xds_decode(&frame->xds, cc_data);
-    } else if (eia608_is_xds(cc_data)) {
+        return frame->status;
+    }
+
+    switch (cls) {
+    case eia608_class_xds:
         frame->status = xds_decode(&frame->xds, cc_data);
-    } else if (eia608_is_control(cc_data)) {
+        break;
+
+    case eia608_class_control:
         frame->status = caption_frame_decode_control(frame, cc_data);
-    } else if (eia608_is_basicna(cc_data) || eia608_is_specialna(cc_data) || eia608_is_westeu(cc_data)) {
+        break;
 
+    case eia608_class_basicna:
+    case eia608_class_specialna:
+    case eia608_class_westeu:
         // Don't decode text if we dont know what mode we are in.
         if (!frame->write) {
             frame->status = LIBCAPTION_OK;
@@ -342,15 +515,434 @@ libcaption_stauts_t caption_frame_decode(caption_frame_t* frame, uint16_t cc_dat
         if (LIBCAPTION_OK == frame->status && caption_frame_painton(frame)) {
             frame->status = LIBCAPTION_READY;
         }
-    } else if (eia608_is_preamble(cc_data)) {
+        break;
+
+    case eia608_class_preamble:
         frame->status = caption_frame_decode_preamble(frame, cc_data);
-    } else if (eia608_is_midrowchange(cc_data)) {
+        break;
+
+    case eia608_class_midrowchange:
         frame->status = caption_frame_decode_midrowchange(frame, cc_data);
+        break;
+
+    default:
+        break;
     }
 
     return frame->status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Coalescing
+static libcaption_stauts_t caption_frame_release(caption_frame_t* frame, double timestamp)
+{
+    caption_frame_coalesce_t* co = &frame->coalesce;
+    co->pending = 0;
+
+    if (co->policy & caption_frame_coalesce_content) {
+        uint64_t hash = caption_frame_hash(frame);
+
+        if (hash == co->hash) {
+            return LIBCAPTION_OK;
+        }
+
+        co->hash = hash;
+    }
+
+    co->last = timestamp;
+    return LIBCAPTION_READY;
+}
+
+static libcaption_stauts_t caption_frame_coalesce(caption_frame_t* frame, libcaption_stauts_t status, double timestamp)
+{
+    caption_frame_coalesce_t* co = &frame->coalesce;
+    int row_done = co->row_done, display = co->display;
+    co->row_done = co->display = 0;
+
+    if (LIBCAPTION_ERROR == status) {
+        return status;
+    }
+
+    if (LIBCAPTION_READY == status) {
+        co->pending = 1;
+    }
+
+    if (!co->pending) {
+        return status;
+    }
+
+    if (!display && (co->policy & (caption_frame_coalesce_interval | caption_frame_coalesce_row))) {
+        int release = ((co->policy & caption_frame_coalesce_row) && row_done)
+            || ((co->policy & caption_frame_coalesce_interval) && (0 > co->last || co->interval <= timestamp - co->last));
+
+        if (!release) {
+            return LIBCAPTION_OK;
+        }
+    }
+
+    return caption_frame_release(frame, timestamp);
+}
+
+static inline libcaption_stauts_t caption_frame_publish(caption_frame_t* frame, libcaption_stauts_t status)
+{
+    if (LIBCAPTION_READY == status && frame->publisher) {
+        caption_publisher_publish(frame->publisher, frame);
+    }
+
+    return status;
+}
+
+static libcaption_stauts_t caption_frame_decode_class(caption_frame_t* frame, uint16_t cc_data, eia608_class_t cls, double timestamp)
+{
+    if (!frame->coalesce.policy) {
+        return caption_frame_publish(frame, caption_frame_decode_cc(frame, cc_data, cls, timestamp));
+    }
+
+    // A released READY must survive padding, so the next window starts with a fresh timestamp
+    int released = LIBCAPTION_READY == frame->status;
+    libcaption_stauts_t status = caption_frame_coalesce(frame, caption_frame_decode_cc(frame, cc_data, cls, timestamp), timestamp);
+    frame->status = (released && LIBCAPTION_OK == status && eia608_is_padding(cc_data)) ? LIBCAPTION_READY : status;
+    return caption_frame_publish(frame, status);
+}
+
+libcaption_stauts_t caption_frame_decode(caption_frame_t* frame, uint16_t cc_data, double timestamp)
+{
+    return caption_frame_decode_class(frame, cc_data, eia608_classify(cc_data), timestamp);
+}
+
+// Number of padding words at the start of cc_data
+static size_t caption_frame_padding_run(const uint16_t* cc_data, size_t count)
+{
+    size_t i = 0;
+    uint64_t four;
+
+    for (; i + 4 <= count; i += 4) {
+        memcpy(&four, &cc_data[i], sizeof(four));
+
+        if (0x8080808080808080ULL != four) {
+            break;
+        }
+    }
+
+    while (i < count && eia608_is_padding(cc_data[i])) {
+        ++i;
+    }
+
+    return i;
+}
+
+libcaption_stauts_t caption_frame_decode_many(caption_frame_t* frame, const uint16_t* cc_data, size_t count, double timestamp, size_t* consumed)
+{
+    size_t i = 0, block = 0, block_end = 0;
+    uint64_t failed = 0;
+    libcaption_stauts_t status = LIBCAPTION_OK;
+
+    while (i < count) {
+        // Parity is checked 64 words at a time, the bitmap then stands in for the per word check
+        if (block_end <= i) {
+            block = i, block_end = 64 < count - i ? i + 64 : count;
+            eia608_parity_varify_many(&cc_data[block], block_end - block, &failed);
+        }
+
+        eia608_class_t cls = (failed >> (i - block)) & 1 ? eia608_class_invalid : eia608_classify_unchecked(cc_data[i]);
+        status = caption_frame_decode_class(frame, cc_data[i], cls, timestamp);
+
+        if (LIBCAPTION_OK != status) {
+            ++i;
+            break;
+        }
+
+        // Repeated padding at the same timestamp can not change the frame, decoding one is enough
+        i += eia608_is_padding(cc_data[i]) ? caption_frame_padding_run(&cc_data[i], count - i) : 1;
+    }
+
+    if (consumed) {
+        (*consumed) = i;
+    }
+
+    return status;
+}
+
+libcaption_stauts_t caption_frame_flush(caption_frame_t* frame)
+{
+    if (!frame->coalesce.pending) {
+        return LIBCAPTION_OK;
+    }
+
+    frame->status = caption_frame_release(frame, frame->timestamp);
+    return caption_frame_publish(frame, frame->status);
+}
+
+void caption_frame_set_publisher(caption_frame_t* frame, struct _caption_publisher_t* publisher)
+{
+    frame->publisher = publisher;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Channel demultiplexing
+void caption_decoder_init(caption_decoder_t* decoder)
+{
+    int i;
+
+    for (i = 0; i < CAPTION_CHANNEL_COUNT; ++i) {
+        caption_frame_init(&decoder->frame[i]);
+        decoder->frame[i].state.txt = (caption_channel_text1 <= i) ? 1 : 0;
+    }
+
+    for (i = 0; i < 2; ++i) {
+        decoder->field[i] = (caption_decoder_field_t){ 0, 0, 0, -1 };
+    }
+
+    xds_init(&decoder->xds);
+    decoder->ready = 0;
+}
+
+// Codes with a first byte of 0x10-0x1F carry the data channel in bit 0x0800
+static inline int caption_decoder_is_channel_code(uint16_t cc_data) { return 0x1000 == (0x7000 & cc_data); }
+
+// Returns the channel a word belongs to, tracking the data channel and mode of the field
+static int caption_decoder_route(caption_decoder_field_t* field, int f, uint16_t cc_data)
+{
+    int cc;
+
+    // Everything else, including basic characters, belongs to the channel selected last
+    if (eia608_parity_varify(cc_data) && caption_decoder_is_channel_code(cc_data)) {
+        field->chan = eia608_test_second_channel_bit(cc_data) ? 1 : 0;
+        field->xds = 0;
+
+        if (eia608_is_control(cc_data)) {
+            switch (eia608_parse_control(cc_data, &cc)) {
+            case eia608_control_resume_caption_loading:
+            case eia608_control_resume_direct_captioning:
+            case eia608_control_roll_up_2:
+            case eia608_control_roll_up_3:
+            case eia608_control_roll_up_4:
+            case eia608_control_end_of_caption:
+                field->text &= ~(1 << field->chan);
+                break;
+
+            case eia608_control_text_restart:
+            case eia608_control_text_resume_text_display:
+                field->text |= (1 << field->chan);
+                break;
+
+            // Caption memory is addressed without leaving text mode
+            case eia608_control_erase_display_memory:
+            case eia608_control_erase_non_displayed_memory:
+                return caption_channel_cc1 + 2 * f + field->chan;
+
+            default:
+                break;
+            }
+        }
+    }
+
+    return (((field->text >> field->chan) & 1) ? caption_channel_text1 : caption_channel_cc1) + 2 * f + field->chan;
+}
+
+static libcaption_stauts_t caption_decoder_xds(caption_decoder_t* decoder, uint16_t cc_data)
+{
+    caption_decoder_field_t* field = &decoder->field[1];
+    int class_code = (0x0F00 & cc_data) >> 8;
+    libcaption_stauts_t status;
+
+    if (eia608_is_xds(cc_data) && decoder->xds.state && 0x0F != class_code) {
+        // Odd class codes start a new packet, even class codes continue an interrupted one
+        field->xds = 1;
+
+        if (!(class_code & 1)) {
+            return LIBCAPTION_OK;
+        }
+
+        decoder->xds.state = 0;
+    }
+
+    status = xds_decode(&decoder->xds, cc_data);
+    field->xds = decoder->xds.state ? 1 : 0;
+
+    if (LIBCAPTION_READY == status) {
+        decoder->ready |= (1 << caption_channel_xds);
+    }
+
+    return status;
+}
+
+libcaption_stauts_t caption_decoder_decode(caption_decoder_t* decoder, int field, uint16_t cc_data, double timestamp)
+{
+    int chan;
+    libcaption_stauts_t status;
+
+    if (0 > field || 1 < field) {
+        return LIBCAPTION_ERROR;
+    }
+
+    caption_decoder_field_t* fld = &decoder->field[field];
+
+    if (eia608_parity_varify(cc_data) && !eia608_is_padding(cc_data)
+        && (eia608_is_xds(cc_data) || (fld->xds && !caption_decoder_is_channel_code(cc_data)))) {
+        // XDS is only carried in field 2
+        return field ? caption_decoder_xds(decoder, cc_data) : LIBCAPTION_OK;
+    }
+
+    chan = caption_decoder_route(fld, field, cc_data);
+
+    // Duplicate control codes are only sent back to back, so forget the last code when the field switches channel
+    if (0 <= fld->last && chan != fld->last) {
+        decoder->frame[fld->last].state.cc_data = 0;
+    }
+
+    fld->last = chan;
+    status = caption_frame_decode(&decoder->frame[chan], cc_data, timestamp);
+
+    if (LIBCAPTION_READY == status) {
+        decoder->ready |= (1 << chan);
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Checkpoints
+// Only non-empty cells are stored, hashes are recomputed on load
+static void caption_frame_buffer_checkpoint(checkpoint_t* cp, caption_frame_buffer_t* buff)
+{
+    int r, c;
+    uint16_t count = 0;
+    uint8_t row, col, attr, size;
+
+    if (!checkpoint_loading(cp)) {
+        for (r = 0; r < SCREEN_ROWS; ++r) {
+            for (c = 0; c < SCREEN_COLS; ++c) {
+                count += buff->cell[r][c].data[0] ? 1 : 0;
+            }
+        }
+
+        checkpoint_u16(cp, &count);
+
+        for (r = 0; r < SCREEN_ROWS; ++r) {
+            for (c = 0; c < SCREEN_COLS; ++c) {
+                caption_frame_cell_t* cell = &buff->cell[r][c];
+
+                if (cell->data[0]) {
+                    row = r, col = c, attr = (cell->sty << 1) | cell->uln;
+                    size = (uint8_t)utf8_char_length(&cell->data[0]);
+                    checkpoint_u8(cp, &row);
+                    checkpoint_u8(cp, &col);
+                    checkpoint_u8(cp, &attr);
+                    checkpoint_u8(cp, &size);
+                    checkpoint_bytes(cp, &cell->data[0], size);
+                }
+            }
+        }
+
+        return;
+    }
+
+    caption_frame_buffer_clear(buff);
+    checkpoint_u16(cp, &count);
+
+    if (SCREEN_ROWS * SCREEN_COLS < count) {
+        checkpoint_fail(cp);
+    }
+
+    for (; LIBCAPTION_ERROR != cp->status && count; --count) {
+        utf8_char_t data[5] = { 0 };
+        checkpoint_u8(cp, &row);
+        checkpoint_u8(cp, &col);
+        checkpoint_u8(cp, &attr);
+        checkpoint_u8(cp, &size);
+
+        if (LIBCAPTION_ERROR == cp->status || SCREEN_ROWS <= row || SCREEN_COLS <= col || 0 == size || 4 < size) {
+            checkpoint_fail(cp);
+            break;
+        }
+
+        checkpoint_bytes(cp, &data[0], size);
+
+        if (LIBCAPTION_ERROR == cp->status || size != utf8_char_length(&data[0])) {
+            checkpoint_fail(cp);
+            break;
+        }
+
+        caption_frame_cell_t* cell = &buff->cell[row][col];
+        uint64_t row_hash = buff->row_hash[row] ^ caption_frame_cell_hash(col, cell);
+        memcpy(&cell->data[0], &data[0], sizeof(data));
+        cell->sty = (attr >> 1) & 0x07;
+        cell->uln = attr & 0x01;
+        buff->row_hash[row] = row_hash ^ caption_frame_cell_hash(col, cell);
+    }
+
+    caption_frame_buffer_rehash(buff);
+}
+
+static void caption_frame_xds_checkpoint(checkpoint_t* cp, xds_t* xds)
+{
+    uint8_t state = (uint8_t)xds->state, size = (uint8_t)xds->size;
+    checkpoint_u8(cp, &state);
+    checkpoint_u8(cp, &xds->class_code);
+    checkpoint_u8(cp, &xds->type);
+    checkpoint_u8(cp, &size);
+
+    if (sizeof(xds->content) < size) {
+        checkpoint_fail(cp);
+        return;
+    }
+
+    checkpoint_bytes(cp, &xds->content[0], size);
+    checkpoint_u8(cp, &xds->checksum);
+    xds->state = state;
+    xds->size = size;
+}
+
+libcaption_stauts_t caption_frame_checkpoint(checkpoint_t* cp, caption_frame_t* frame)
+{
+    caption_frame_state_t* state = &frame->state;
+    caption_frame_coalesce_t* co = &frame->coalesce;
+    uint8_t status = (uint8_t)frame->status;
+    uint8_t bits = state->uln | (state->sty << 1) | (state->rup << 4) | (state->txt << 6);
+    uint8_t row = (uint8_t)state->row, col = (uint8_t)state->col;
+    uint8_t write = (frame->write == &frame->front) ? 1 : (frame->write == &frame->back) ? 2 : 0;
+    uint8_t policy = co->policy | (co->pending << 3) | (co->row_done << 4) | (co->display << 5);
+
+    checkpoint_double(cp, &frame->timestamp);
+    checkpoint_u8(cp, &status);
+    checkpoint_u8(cp, &bits);
+    checkpoint_u8(cp, &row);
+    checkpoint_u8(cp, &col);
+    checkpoint_u16(cp, &state->cc_data);
+    checkpoint_u8(cp, &write);
+    checkpoint_u8(cp, &policy);
+    checkpoint_double(cp, &co->interval);
+    checkpoint_double(cp, &co->last);
+    checkpoint_u64(cp, &co->hash);
+    caption_frame_xds_checkpoint(cp, &frame->xds);
+    caption_frame_buffer_checkpoint(cp, &frame->front);
+    caption_frame_buffer_checkpoint(cp, &frame->back);
+
+    if (!checkpoint_loading(cp) || LIBCAPTION_ERROR == cp->status) {
+        return cp->status;
+    }
+
+    if (LIBCAPTION_READY < status || 2 < write) {
+        return checkpoint_fail(cp);
+    }
+
+    frame->status = (libcaption_stauts_t)status;
+    state->uln = bits & 0x01;
+    state->sty = (bits >> 1) & 0x07;
+    state->rup = (bits >> 4) & 0x03;
+    state->txt = (bits >> 6) & 0x01;
+    state->row = (int8_t)row;
+    state->col = (int8_t)col;
+    frame->write = (1 == write) ? &frame->front : (2 == write) ? &frame->back : 0;
+    co->policy = policy & 0x07;
+    co->pending = (policy >> 3) & 0x01;
+    co->row_done = (policy >> 4) & 0x01;
+    co->display = (policy >> 5) & 0x01;
+    frame->text.dirty = CAPTION_FRAME_ALL_ROWS;
+    return cp->status;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int caption_frame_from_text(caption_frame_t* frame, const utf8_char_t* data)
 {
@@ -381,30 +973,52 @@ int caption_frame_from_text(caption_frame_t* frame, const utf8_char_t* data)
     return 0;
 }
 ////////////////////////////////////////////////////////////////////////////////
-size_t caption_frame_to_text(caption_frame_t* frame, utf8_char_t* data)
+// Renders a single row of the front buffer into the row cache
+static void caption_frame_render_row(caption_frame_t* frame, int r)
 {
-    int r, c, uln, crlf = 0, count = 0;
+    int c, count = 0;
     size_t s, size = 0;
-    eia608_style_t sty;
+    utf8_char_t* data = &frame->text.data[r][0];
+    (*data) = '\0';
+
+    for (c = 0; c < SCREEN_COLS; ++c) {
+        const utf8_char_t* chr = &frame->front.cell[r][c].data[0];
+        // dont start a new line until we encounter at least one printable character
+        if (0 < utf8_char_length(chr) && (0 < count || !utf8_char_whitespace(chr))) {
+            s = utf8_char_copy(data, chr);
+            data += s, size += s, ++count;
+        }
+    }
+
+    frame->text.size[r] = (uint8_t)size;
+}
+
+size_t caption_frame_to_text(caption_frame_t* frame, utf8_char_t* data)
+{
+    int r;
+    size_t size = 0;
     (*data) = '\0';
 
     for (r = 0; r < SCREEN_ROWS; ++r) {
-        crlf += count, count = 0;
-        for (c = 0; c < SCREEN_COLS; ++c) {
-            const utf8_char_t* chr = caption_frame_read_char(frame, r, c, &sty, &uln);
-            // dont start a new line until we encounter at least one printable character
-            if (0 < utf8_char_length(chr) && (0 < count || !utf8_char_whitespace(chr))) {
-                if (0 < crlf) {
-                    memcpy(data, "\r\n\0", 3);
-                    data += 2, size += 2, crlf = 0;
-                }
+        if (frame->text.dirty & (1 << r)) {
+            caption_frame_render_row(frame, r);
+        }
 
-                s = utf8_char_copy(data, chr);
-                data += s, size += s, ++count;
-            }
+        if (0 == frame->text.size[r]) {
+            continue;
+        }
+
+        if (0 < size) {
+            memcpy(data, "\r\n", 2);
+            data += 2, size += 2;
         }
+
+        // copy the null terminator too
+        memcpy(data, &frame->text.data[r][0], frame->text.size[r] + 1);
+        data += frame->text.size[r], size += frame->text.size[r];
     }
 
+    frame->text.dirty = 0;
     return size;
 }
 ////////////////////////////////////////////////////////////////////////////////
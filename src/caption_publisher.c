@@ -0,0 +1,93 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "caption_publisher.h"
+#include <string.h>
+
+// Each slot is a seqlock. The publisher makes slot->seq odd, writes the snapshot and makes it even
+// again, readers retry if slot->seq was odd or changed while they copied the snapshot.
+#if defined(_MSC_VER)
+#include <windows.h>
+static inline uint64_t caption_atomic_load(volatile uint64_t* p) { return (uint64_t)InterlockedCompareExchange64((volatile LONG64*)p, 0, 0); }
+static inline void caption_atomic_store(volatile uint64_t* p, uint64_t v) { InterlockedExchange64((volatile LONG64*)p, (LONG64)v); }
+static inline void caption_atomic_fence(void) { MemoryBarrier(); }
+#else
+static inline uint64_t caption_atomic_load(volatile uint64_t* p) { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+static inline void caption_atomic_store(volatile uint64_t* p, uint64_t v) { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+static inline void caption_atomic_fence(void) { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+#endif
+
+void caption_publisher_init(caption_publisher_t* pub)
+{
+    memset(pub, 0, sizeof(caption_publisher_t));
+}
+
+void caption_publisher_publish(caption_publisher_t* pub, caption_frame_t* frame)
+{
+    uint64_t sequence = pub->latest + 1;
+    caption_publisher_slot_t* slot = &pub->slot[sequence % CAPTION_PUBLISHER_SLOTS];
+    caption_snapshot_t* snapshot = &slot->snapshot;
+
+    caption_atomic_store(&slot->seq, slot->seq + 1);
+    caption_atomic_fence();
+
+    snapshot->sequence = sequence;
+    snapshot->timestamp = frame->timestamp;
+    snapshot->hash = caption_frame_hash(frame);
+    memcpy(&snapshot->screen, &frame->front, sizeof(caption_frame_buffer_t));
+    snapshot->size = caption_frame_to_text(frame, &snapshot->text[0]);
+
+    caption_atomic_store(&slot->seq, slot->seq + 1);
+    caption_atomic_store(&pub->latest, sequence);
+}
+
+int caption_publisher_read(caption_publisher_t* pub, caption_snapshot_t* snapshot)
+{
+    for (;;) {
+        uint64_t sequence = caption_atomic_load(&pub->latest);
+
+        if (0 == sequence) {
+            return 0;
+        }
+
+        caption_publisher_slot_t* slot = &pub->slot[sequence % CAPTION_PUBLISHER_SLOTS];
+        uint64_t seq = caption_atomic_load(&slot->seq);
+
+        if (seq & 1) {
+            continue;
+        }
+
+        memcpy(snapshot, (const void*)&slot->snapshot, sizeof(caption_snapshot_t));
+        caption_atomic_fence();
+
+        // The slot may have been reused for a newer snapshot, which is fine as long as it was not torn
+        if (seq == caption_atomic_load(&slot->seq)) {
+            return 1;
+        }
+    }
+}
+
+uint64_t caption_publisher_sequence(caption_publisher_t* pub)
+{
+    return caption_atomic_load(&pub->latest);
+}
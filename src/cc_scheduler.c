@@ -0,0 +1,84 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "cc_scheduler.h"
+#include <string.h>
+
+// Largest cc_count a cea708_t accepts, see cea708_add_cc_data
+#define CC_SCHEDULER_MAX_CC_COUNT 30
+
+int cc_scheduler_cc_count(double fps)
+{
+    int cc_count = 0 < fps ? (int)(600.0 / fps + 0.5) : CC_SCHEDULER_MAX_CC_COUNT;
+    return cc_count < 1 ? 1 : CC_SCHEDULER_MAX_CC_COUNT < cc_count ? CC_SCHEDULER_MAX_CC_COUNT : cc_count;
+}
+
+void cc_scheduler_init(cc_scheduler_t* sched, double fps)
+{
+    memset(sched, 0, sizeof(cc_scheduler_t));
+    sched->cc_count = (uint8_t)cc_scheduler_cc_count(fps);
+    sched->rate = 0 < fps ? CC_SCHEDULER_608_RATE / fps : 1.0;
+}
+
+void cc_scheduler_free(cc_scheduler_t* sched)
+{
+    cmdlist_free(&sched->field[0]);
+    cmdlist_free(&sched->field[1]);
+    cmdlist_free(&sched->dtvcc);
+}
+
+libcaption_stauts_t cc_scheduler_frame(cc_scheduler_t* sched, cea708_t* cea708)
+{
+    int f;
+
+    if (0 != cea708->user_data.cc_count) {
+        return LIBCAPTION_ERROR;
+    }
+
+    // Free cc_data slots, cc_count is known to be zero
+    size_t room = sched->cc_count - cea708->user_data.cc_count;
+
+    for (f = 0; f < 2; ++f) {
+        cc_data_cmdlist_t* queue = &sched->field[f];
+        sched->credit[f] += sched->rate;
+
+        size_t pairs = (size_t)sched->credit[f];
+        pairs = cea708_drain_cmdlist(cea708, queue, room < pairs ? room : pairs);
+        sched->credit[f] -= (double)pairs;
+        room -= pairs;
+
+        // An idle field must not save up credit, or it would burst once new data arrives
+        if (0 == queue->length) {
+            sched->credit[f] = 0;
+        }
+    }
+
+    cea708_drain_cmdlist(cea708, &sched->dtvcc, room);
+
+    while (cea708->user_data.cc_count < sched->cc_count) {
+        cea708_add_cc_data(cea708, 0, cc_type_ntsc_cc_field_1, 0x0000);
+    }
+
+    cea708->fixed_count = 1;
+    return LIBCAPTION_OK;
+}
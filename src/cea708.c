@@ -210,8 +210,9 @@ int cea708_render(cea708_t* cea708, uint8_t* data, size_t size)
     }
 
     // Make sure we have at least 5 blocks, and a multiple of
-    // 5 blocks.
+    // 5 blocks. Unless the count was sized for the frame rate.
     uint8_t fake_count = (
+        cea708->fixed_count ? 0 :
         cea708->user_data.cc_count == 0 ? 5 :
         cea708->user_data.cc_count % 5 == 0 ? 0 :
         5 - (cea708->user_data.cc_count % 5)
@@ -286,54 +287,39 @@ void cea708_dump(cea708_t* cea708)
     }
 }
 
-libcaption_stauts_t cea708_to_caption_frame(caption_frame_t* frame, cea708_t* cea708, dtvcc_packet_t* dtvcc, uint8_t* dtvcc_pos)
+static libcaption_stauts_t cea708_dtvcc_data(dtvcc_packet_t* dtvcc, uint8_t* dtvcc_pos, cea708_cc_type_t type, uint16_t cc_data)
 {
-    int i, count = cea708_cc_count(&cea708->user_data);
-    libcaption_stauts_t status = LIBCAPTION_OK;
-
-    if (GA94 == cea708->user_identifier) {
-        for (i = 0; i < count; ++i) {
-            int valid;
-            cea708_cc_type_t type;
-            uint16_t cc_data = cea708_cc_data(&cea708->user_data, i, &valid, &type);
-
-            if (!valid) {
-                continue;
+    switch (type) {
+        case cc_type_dtvcc_packet_start:
+            if (*dtvcc_pos == 0) {
+                libcaption_stauts_t status = dtvcc_packet_start(dtvcc, cc_data >> 8, cc_data & 0xff);
+                *dtvcc_pos = 1;
+                return status;
+            } else {
+                fprintf(stderr, "unexpected packet start!\n");
+                exit(1);
             }
-
-            switch (type) {
-                case cc_type_ntsc_cc_field_1:
-                    status = libcaption_status_update(status, caption_frame_decode(frame, cc_data, cea708->timestamp));
-                    break;
-
-                case cc_type_dtvcc_packet_start:
-                    if (*dtvcc_pos == 0) {
-                        status = libcaption_status_update(
-                            status, dtvcc_packet_start(dtvcc, cc_data >> 8, cc_data & 0xff));
-                        *dtvcc_pos = 1;
-                    } else {
-                        fprintf(stderr, "unexpected packet start!\n");
-                        exit(1);
-                    }
-                    break;
-
-                case cc_type_dtvcc_packet_data:
-                    if (*dtvcc_pos > 0) {
-                        status = libcaption_status_update(
-                            status, dtvcc_packet_data(dtvcc, cc_data >> 8, cc_data & 0xff, dtvcc_pos));
-                    } else {
-                        fprintf(stderr, "unexpected data!\n");
-                        exit(1);
-                    }
-                    break;
-
-                default:
-                    // fprintf(stderr, "unhandled type (%u): data = %04x\n", type, cc_data);
-                    break;
+            break;
+
+        case cc_type_dtvcc_packet_data:
+            if (*dtvcc_pos > 0) {
+                return dtvcc_packet_data(dtvcc, cc_data >> 8, cc_data & 0xff, dtvcc_pos);
+            } else {
+                fprintf(stderr, "unexpected data!\n");
+                exit(1);
             }
-        }
+            break;
+
+        default:
+            // fprintf(stderr, "unhandled type (%u): data = %04x\n", type, cc_data);
+            break;
     }
 
+    return LIBCAPTION_OK;
+}
+
+static libcaption_stauts_t cea708_dtvcc_end(dtvcc_packet_t* dtvcc, uint8_t* dtvcc_pos, libcaption_stauts_t status)
+{
     if (*dtvcc_pos > 0 && dtvcc->packet_data_size == *dtvcc_pos && status != LIBCAPTION_ERROR) {
         // End of DTVCC packet, time to parse it.
         uint8_t pos = 0;
@@ -361,3 +347,55 @@ libcaption_stauts_t cea708_to_caption_frame(caption_frame_t* frame, cea708_t* ce
 
     return status;
 }
+
+libcaption_stauts_t cea708_to_caption_frame(caption_frame_t* frame, cea708_t* cea708, dtvcc_packet_t* dtvcc, uint8_t* dtvcc_pos)
+{
+    int i, count = cea708_cc_count(&cea708->user_data);
+    libcaption_stauts_t status = LIBCAPTION_OK;
+
+    if (GA94 == cea708->user_identifier) {
+        for (i = 0; i < count; ++i) {
+            int valid;
+            cea708_cc_type_t type;
+            uint16_t cc_data = cea708_cc_data(&cea708->user_data, i, &valid, &type);
+
+            if (!valid) {
+                continue;
+            }
+
+            if (cc_type_ntsc_cc_field_1 == type) {
+                status = libcaption_status_update(status, caption_frame_decode(frame, cc_data, cea708->timestamp));
+            } else {
+                status = libcaption_status_update(status, cea708_dtvcc_data(dtvcc, dtvcc_pos, type, cc_data));
+            }
+        }
+    }
+
+    return cea708_dtvcc_end(dtvcc, dtvcc_pos, status);
+}
+
+libcaption_stauts_t cea708_to_caption_decoder(caption_decoder_t* decoder, cea708_t* cea708, dtvcc_packet_t* dtvcc, uint8_t* dtvcc_pos)
+{
+    int i, count = cea708_cc_count(&cea708->user_data);
+    libcaption_stauts_t status = LIBCAPTION_OK;
+
+    if (GA94 == cea708->user_identifier) {
+        for (i = 0; i < count; ++i) {
+            int valid;
+            cea708_cc_type_t type;
+            uint16_t cc_data = cea708_cc_data(&cea708->user_data, i, &valid, &type);
+
+            if (!valid) {
+                continue;
+            }
+
+            if (cc_type_ntsc_cc_field_1 == type || cc_type_ntsc_cc_field_2 == type) {
+                status = libcaption_status_update(status, caption_decoder_decode(decoder, cc_type_ntsc_cc_field_2 == type, cc_data, cea708->timestamp));
+            } else {
+                status = libcaption_status_update(status, cea708_dtvcc_data(dtvcc, dtvcc_pos, type, cc_data));
+            }
+        }
+    }
+
+    return cea708_dtvcc_end(dtvcc, dtvcc_pos, status);
+}
@@ -1,7 +1,21 @@
 #include "cea708_charmap.h"
 
-// prototype for re2c generated function
-uint16_t _cea708_from_utf8(const utf8_char_t* s);
 uint16_t cea708_from_utf8_1(const utf8_char_t* c) {
-    return _cea708_from_utf8(c);
+    uint32_t codepoint;
+
+    if (!c) {
+        return 0x0000;
+    }
+
+    // ASCII indexes the table directly
+    if (0x80 > (unsigned char)c[0]) {
+        return cea708_from_codepoint[(unsigned char)c[0]];
+    }
+
+    codepoint = utf8_char_codepoint(c);
+    if (CEA708_FROM_CODEPOINT_LIMIT <= codepoint) {
+        return 0x0000;
+    }
+
+    return cea708_from_codepoint[(cea708_from_codepoint_block[codepoint >> 6] << 6) | (codepoint & 0x3F)];
 }
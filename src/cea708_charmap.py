@@ -44,9 +44,6 @@ SPECIALS = {
 for p in range(0xa0, 0x100):
     SPECIALS[p] = bytes([p]).decode('latin-1')
 
-SPECIALS_ORDER = [k for k, v in sorted(SPECIALS.items(), key=lambda x: x[1])]
-
-
 def c_hex(s: bytes) -> str:
     o = '"'
     for c in s:
@@ -54,22 +51,9 @@ def c_hex(s: bytes) -> str:
     return o + '"'
 
 
-def re2c_out(uchar: str, cchar: int):
-    print(f'''
-    {c_hex(uchar.encode('utf-8'))} {{
-        // {unicodedata.name(uchar)}
-        return 0x{cchar:04x};
-    }}
-    ''')
-
-
-for p in (G0_CHARS + G1_CHARS + G2_CHARS):
-    utf_escaped = c_hex(p.encode('utf-8'))
-    utf_name = unicodedata.name(p).replace(' ', '_').replace('-', '_')
-
-    print(f'#define CEA708_CHAR_{utf_name} {utf_escaped}')
-
+if __name__ == '__main__':
+    for p in (G0_CHARS + G1_CHARS + G2_CHARS):
+        utf_escaped = c_hex(p.encode('utf-8'))
+        utf_name = unicodedata.name(p).replace(' ', '_').replace('-', '_')
 
-for k in SPECIALS_ORDER:
-    re2c_out(SPECIALS[k], k)
-re2c_out('♪', 0x7f)
+        print(f'#define CEA708_CHAR_{utf_name} {utf_escaped}')
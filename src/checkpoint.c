@@ -0,0 +1,182 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "checkpoint.h"
+#include <string.h>
+
+static const uint8_t checkpoint_magic[4] = { 'L', 'C', 'C', 'P' };
+
+void checkpoint_init_save(checkpoint_t* cp, uint8_t* data, size_t size)
+{
+    cp->data = data;
+    cp->size = data ? size : 0;
+    cp->pos = 0;
+    cp->load = 0;
+    cp->status = LIBCAPTION_OK;
+}
+
+void checkpoint_init_load(checkpoint_t* cp, const uint8_t* data, size_t size)
+{
+    cp->data = (uint8_t*)data;
+    cp->size = data ? size : 0;
+    cp->pos = 0;
+    cp->load = 1;
+    cp->status = LIBCAPTION_OK;
+}
+
+void checkpoint_bytes(checkpoint_t* cp, void* data, size_t size)
+{
+    if (LIBCAPTION_ERROR == cp->status) {
+        return;
+    }
+
+    if (!cp->load && !cp->data) {
+        cp->pos += size;
+        return;
+    }
+
+    if (cp->size - cp->pos < size) {
+        checkpoint_fail(cp);
+        return;
+    }
+
+    if (cp->load) {
+        memcpy(data, &cp->data[cp->pos], size);
+    } else {
+        memcpy(&cp->data[cp->pos], data, size);
+    }
+
+    cp->pos += size;
+}
+
+// Fixed size little endian integers
+static void checkpoint_uint(checkpoint_t* cp, uint64_t* value, int bytes)
+{
+    int i;
+    uint8_t buf[8];
+
+    for (i = 0; !cp->load && i < bytes; ++i) {
+        buf[i] = (uint8_t)((*value) >> (8 * i));
+    }
+
+    checkpoint_bytes(cp, &buf[0], bytes);
+
+    if (cp->load) {
+        for ((*value) = 0, i = 0; LIBCAPTION_ERROR != cp->status && i < bytes; ++i) {
+            (*value) |= (uint64_t)buf[i] << (8 * i);
+        }
+    }
+}
+
+void checkpoint_u8(checkpoint_t* cp, uint8_t* value)
+{
+    checkpoint_bytes(cp, value, 1);
+}
+
+void checkpoint_u16(checkpoint_t* cp, uint16_t* value)
+{
+    uint64_t v = (*value);
+    checkpoint_uint(cp, &v, 2);
+    (*value) = (uint16_t)v;
+}
+
+void checkpoint_u32(checkpoint_t* cp, uint32_t* value)
+{
+    uint64_t v = (*value);
+    checkpoint_uint(cp, &v, 4);
+    (*value) = (uint32_t)v;
+}
+
+void checkpoint_u64(checkpoint_t* cp, uint64_t* value)
+{
+    checkpoint_uint(cp, value, 8);
+}
+
+void checkpoint_double(checkpoint_t* cp, double* value)
+{
+    uint64_t v;
+    memcpy(&v, value, sizeof(v));
+    checkpoint_uint(cp, &v, 8);
+    memcpy(value, &v, sizeof(v));
+}
+
+libcaption_stauts_t checkpoint_header(checkpoint_t* cp)
+{
+    uint8_t magic[4], version = CHECKPOINT_VERSION;
+    memcpy(&magic[0], &checkpoint_magic[0], sizeof(magic));
+    checkpoint_bytes(cp, &magic[0], sizeof(magic));
+    checkpoint_u8(cp, &version);
+
+    if (cp->load && (0 != memcmp(&magic[0], &checkpoint_magic[0], sizeof(magic)) || CHECKPOINT_VERSION != version)) {
+        checkpoint_fail(cp);
+    }
+
+    return cp->status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Sections are a type byte and a 32 bit body length followed by the body
+size_t checkpoint_section_open(checkpoint_t* cp, checkpoint_section_t section)
+{
+    uint8_t type = (uint8_t)section;
+    uint32_t length = 0;
+    checkpoint_u8(cp, &type);
+    checkpoint_u32(cp, &length);
+    return cp->pos;
+}
+
+void checkpoint_section_close(checkpoint_t* cp, size_t open)
+{
+    size_t end = cp->pos;
+    uint32_t length = (uint32_t)(end - open);
+
+    if (LIBCAPTION_ERROR == cp->status || !cp->data || open < 4) {
+        return;
+    }
+
+    cp->pos = open - 4;
+    checkpoint_u32(cp, &length);
+    cp->pos = end;
+}
+
+libcaption_stauts_t checkpoint_section_next(checkpoint_t* cp, checkpoint_section_t* section, checkpoint_t* body)
+{
+    uint8_t type = checkpoint_section_end;
+    uint32_t length = 0;
+
+    checkpoint_u8(cp, &type);
+    (*section) = (checkpoint_section_t)type;
+
+    if (checkpoint_section_end != type) {
+        checkpoint_u32(cp, &length);
+    }
+
+    if (LIBCAPTION_ERROR == cp->status || cp->size - cp->pos < length) {
+        checkpoint_init_load(body, 0, 0);
+        return checkpoint_fail(cp);
+    }
+
+    checkpoint_init_load(body, &cp->data[cp->pos], length);
+    cp->pos += length;
+    return LIBCAPTION_OK;
+}
@@ -1,30 +1,122 @@
 
 #include "cmdlist.h"
 
+#include <stdlib.h>
 #include <string.h>
 
+// Enough for a short pop-on caption before the first resize
+#define CMDLIST_INITIAL_CAPACITY 64
+// Commands that fit in one cea708 block
+#define CMDLIST_CEA708_MAX 30
+
+void cmdlist_init(cc_data_cmdlist_t* cmdlist) {
+    memset(cmdlist, 0, sizeof(cc_data_cmdlist_t));
+}
+
+void cmdlist_free(cc_data_cmdlist_t* cmdlist) {
+    free(cmdlist->commands);
+    cmdlist_init(cmdlist);
+}
+
+static libcaption_stauts_t cmdlist_grow(cc_data_cmdlist_t* cmdlist) {
+    size_t capacity = cmdlist->capacity ? cmdlist->capacity * 2 : CMDLIST_INITIAL_CAPACITY;
+    cc_data_t* commands = (cc_data_t*)realloc(cmdlist->commands, capacity * sizeof(cc_data_t));
+
+    if (commands == NULL) {
+        return LIBCAPTION_ERROR;
+    }
+
+    // The ring was full, so moving the wrapped front to the end of the old storage keeps it in order
+    memcpy(&commands[cmdlist->capacity], &commands[0], cmdlist->head * sizeof(cc_data_t));
+    cmdlist->commands = commands;
+    cmdlist->capacity = capacity;
+    return LIBCAPTION_OK;
+}
+
 libcaption_stauts_t cmdlist_push(cc_data_cmdlist_t* cmdlist, int valid, cea708_cc_type_t type, uint16_t cc_data) {
-    if (cmdlist == NULL || cmdlist->length >= MAX_CC_CMDLIST_SIZE) {
+    if (cmdlist == NULL) {
         return LIBCAPTION_ERROR;
     }
 
-    uint16_t i = cmdlist->length;
+    if (cmdlist->length == cmdlist->capacity && cmdlist_grow(cmdlist) != LIBCAPTION_OK) {
+        return LIBCAPTION_ERROR;
+    }
+
+    cc_data_t* command = &cmdlist->commands[(cmdlist->head + cmdlist->length) & (cmdlist->capacity - 1)];
     cmdlist->length++;
 
-    cmdlist->commands[i].marker_bits = 0x1f;
-    cmdlist->commands[i].cc_valid = valid;
-    cmdlist->commands[i].cc_type = type;
-    cmdlist->commands[i].cc_data = cc_data;
+    command->marker_bits = 0x1f;
+    command->cc_valid = valid;
+    command->cc_type = type;
+    command->cc_data = cc_data;
 
     return LIBCAPTION_OK;
 }
 
+size_t cmdlist_drain(cc_data_cmdlist_t* cmdlist, size_t count) {
+    if (cmdlist == NULL) {
+        return 0;
+    }
+
+    if (count >= cmdlist->length) {
+        count = cmdlist->length;
+        cmdlist_clear(cmdlist);
+        return count;
+    }
+
+    cmdlist->head = (cmdlist->head + count) & (cmdlist->capacity - 1);
+    cmdlist->length -= count;
+    return count;
+}
+
+size_t cmdlist_erase(cc_data_cmdlist_t* cmdlist, size_t pos, size_t count) {
+    size_t i, mask;
+
+    if (cmdlist == NULL || pos >= cmdlist->length) {
+        return 0;
+    }
+
+    if (count > cmdlist->length - pos) {
+        count = cmdlist->length - pos;
+    }
+
+    mask = cmdlist->capacity - 1;
+    for (i = pos + count; i < cmdlist->length; ++i) {
+        cmdlist->commands[(cmdlist->head + i - count) & mask] = cmdlist->commands[(cmdlist->head + i) & mask];
+    }
+
+    cmdlist->length -= count;
+    return count;
+}
+
+size_t cea708_drain_cmdlist(cea708_t* cea708, cc_data_cmdlist_t* cmdlist, size_t count) {
+    size_t i;
+
+    if (cea708 == NULL || cmdlist == NULL || cea708->user_data.cc_count >= CMDLIST_CEA708_MAX) {
+        return 0;
+    }
+
+    if (count > CMDLIST_CEA708_MAX - cea708->user_data.cc_count) {
+        count = CMDLIST_CEA708_MAX - cea708->user_data.cc_count;
+    }
+
+    if (count > cmdlist->length) {
+        count = cmdlist->length;
+    }
+
+    for (i = 0; i < count; ++i) {
+        cea708->user_data.cc_data[cea708->user_data.cc_count++] = *cmdlist_peek(cmdlist, i);
+    }
+
+    return cmdlist_drain(cmdlist, count);
+}
+
 libcaption_stauts_t cea708_add_from_cmdlist(cea708_t* cea708, cc_data_cmdlist_t* cmdlist, uint16_t* pos) {
     if (cea708 == NULL || cmdlist == NULL || pos == NULL) {
         return LIBCAPTION_ERROR;
     }
 
-    if (cea708->user_data.cc_count >= 30) {
+    if (cea708->user_data.cc_count >= CMDLIST_CEA708_MAX) {
         // Out of space
         return LIBCAPTION_ERROR;
     }
@@ -35,7 +127,7 @@ libcaption_stauts_t cea708_add_from_cmdlist(cea708_t* cea708, cc_data_cmdlist_t*
     }
 
     memcpy(&cea708->user_data.cc_data[cea708->user_data.cc_count],
-           &cmdlist->commands[*pos], sizeof(cc_data_t));
+           cmdlist_peek(cmdlist, *pos), sizeof(cc_data_t));
     
     cea708->user_data.cc_count++;
     (*pos)++;
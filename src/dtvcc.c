@@ -78,6 +78,40 @@ libcaption_stauts_t dtvcc_packet_data(dtvcc_packet_t* dtvcc, uint8_t cc_data1, u
     return LIBCAPTION_OK;
 }
 
+libcaption_stauts_t dtvcc_packet_checkpoint(checkpoint_t* cp, dtvcc_packet_t* dtvcc, uint8_t* pos) {
+    if (!dtvcc || !pos) {
+        return checkpoint_fail(cp);
+    }
+
+    uint8_t sequence_number = dtvcc->sequence_number;
+    uint8_t packet_size_code = dtvcc->packet_size_code;
+    uint8_t size = *pos;
+
+    checkpoint_u8(cp, &sequence_number);
+    checkpoint_u8(cp, &packet_size_code);
+    checkpoint_u8(cp, &size);
+
+    if (!checkpoint_loading(cp)) {
+        // Only the bytes received so far are meaningful
+        checkpoint_bytes(cp, dtvcc->packet_data, size);
+        return cp->status;
+    }
+
+    memset(dtvcc, 0, sizeof(dtvcc_packet_t));
+    dtvcc->sequence_number = sequence_number & 0x03;
+    dtvcc->packet_size_code = packet_size_code & 0x3f;
+    dtvcc->packet_data_size = size ? dtvcc_packet_data_size(dtvcc) : 0;
+
+    if (dtvcc->packet_data_size < size) {
+        *pos = 0;
+        return checkpoint_fail(cp);
+    }
+
+    checkpoint_bytes(cp, dtvcc->packet_data, size);
+    *pos = (LIBCAPTION_ERROR == cp->status) ? 0 : size;
+    return cp->status;
+}
+
 libcaption_stauts_t dtvcc_read_service_block(const dtvcc_packet_t* dtvcc, dtvcc_service_block_t* service_block, uint8_t* pos) {
     if (!service_block || !dtvcc || !pos) {
         return LIBCAPTION_ERROR;
@@ -195,6 +229,16 @@ libcaption_stauts_t dtvcc_finish_service_blocks(dtvcc_packet_t* dtvcc, uint8_t s
 }
 
 libcaption_stauts_t dtvcc_packet_to_cmdlist(const dtvcc_packet_t *dtvcc, cc_data_cmdlist_t *cmdlist)
+{
+    if (!cmdlist) {
+        return LIBCAPTION_ERROR;
+    }
+
+    cmdlist_clear(cmdlist);
+    return dtvcc_packet_append_to_cmdlist(dtvcc, cmdlist);
+}
+
+libcaption_stauts_t dtvcc_packet_append_to_cmdlist(const dtvcc_packet_t *dtvcc, cc_data_cmdlist_t *cmdlist)
 {
     if (!dtvcc || !cmdlist || dtvcc->packet_data_size < 1 || (dtvcc->packet_data_size & 0x1) == 0)
     {
@@ -202,8 +246,6 @@ libcaption_stauts_t dtvcc_packet_to_cmdlist(const dtvcc_packet_t *dtvcc, cc_data
     }
     libcaption_stauts_t err = LIBCAPTION_OK;
 
-    memset(cmdlist, 0, sizeof(cc_data_cmdlist_t));
-
     // Start packet
     uint16_t p = ((dtvcc->sequence_number & 0x03) << 14) |
                  ((dtvcc->packet_size_code & 0x3f) << 8) |
@@ -28,6 +28,125 @@
 
 #include "caption_frame.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && 2 <= _M_IX86_FP)
+#include <emmintrin.h>
+#define EIA608_PARITY_SSE2
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Bulk parity
+// Folding the 7 data bits of each byte down to bit 0 leaves 1 there when the count of ones is odd.
+// Odd parity sets bit 7 when the count is even. Shifts never move bits across bytes into bit 0 or 8,
+// so the same steps work on any number of packed 16 bit words.
+static inline uint64_t eia608_parity_swar(uint64_t w)
+{
+    uint64_t p;
+    w &= 0x7F7F7F7F7F7F7F7FULL;
+    p = w ^ (w >> 4);
+    p ^= p >> 2;
+    p ^= p >> 1;
+    return w | ((~p & 0x0101010101010101ULL) << 7);
+}
+
+static inline uint64_t eia608_parity_load4(const uint16_t* cc_data)
+{
+    return (uint64_t)cc_data[0] | ((uint64_t)cc_data[1] << 16) | ((uint64_t)cc_data[2] << 32) | ((uint64_t)cc_data[3] << 48);
+}
+
+#ifdef EIA608_PARITY_SSE2
+static inline __m128i eia608_parity_sse2(__m128i w)
+{
+    __m128i p;
+    w = _mm_and_si128(w, _mm_set1_epi16(0x7F7F));
+    p = _mm_xor_si128(w, _mm_srli_epi16(w, 4));
+    p = _mm_xor_si128(p, _mm_srli_epi16(p, 2));
+    p = _mm_xor_si128(p, _mm_srli_epi16(p, 1));
+    return _mm_or_si128(w, _mm_slli_epi16(_mm_andnot_si128(p, _mm_set1_epi16(0x0101)), 7));
+}
+#endif
+
+void eia608_parity_apply_many(uint16_t* cc_data, size_t count)
+{
+    size_t i = 0;
+
+#ifdef EIA608_PARITY_SSE2
+    for (; i + 8 <= count; i += 8) {
+        __m128i w = _mm_loadu_si128((const __m128i*)&cc_data[i]);
+        _mm_storeu_si128((__m128i*)&cc_data[i], eia608_parity_sse2(w));
+    }
+#endif
+
+    for (; i + 4 <= count; i += 4) {
+        uint64_t w = eia608_parity_swar(eia608_parity_load4(&cc_data[i]));
+        cc_data[i + 0] = (uint16_t)(w >> 0);
+        cc_data[i + 1] = (uint16_t)(w >> 16);
+        cc_data[i + 2] = (uint16_t)(w >> 32);
+        cc_data[i + 3] = (uint16_t)(w >> 48);
+    }
+
+    for (; i < count; ++i) {
+        cc_data[i] = eia608_parity_word(cc_data[i]);
+    }
+}
+
+// Bit i of the result is set if cc_data[i] fails, for up to 64 words
+static uint64_t eia608_parity_varify_block(const uint16_t* cc_data, size_t count)
+{
+    size_t i = 0;
+    uint64_t failed = 0;
+
+#ifdef EIA608_PARITY_SSE2
+    for (; i + 8 <= count; i += 8) {
+        __m128i w = _mm_loadu_si128((const __m128i*)&cc_data[i]);
+        __m128i ok = _mm_cmpeq_epi16(w, eia608_parity_sse2(w));
+        failed |= (uint64_t)(~_mm_movemask_epi8(_mm_packs_epi16(ok, ok)) & 0xFF) << i;
+    }
+#endif
+
+    for (; i + 4 <= count; i += 4) {
+        uint64_t w = eia608_parity_load4(&cc_data[i]);
+        // Only bits 7 and 15 of each word can differ
+        uint64_t d = (w ^ eia608_parity_swar(w)) & 0x8080808080808080ULL;
+        d |= d >> 8;
+        failed |= (((d >> 7) & 1) | ((d >> 22) & 2) | ((d >> 37) & 4) | ((d >> 52) & 8)) << i;
+    }
+
+    for (; i < count; ++i) {
+        failed |= (uint64_t)(eia608_parity_word(cc_data[i]) != cc_data[i]) << i;
+    }
+
+    return failed;
+}
+
+static inline size_t eia608_popcount64(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)__builtin_popcountll(x);
+#else
+    size_t n = 0;
+    for (; x; x &= x - 1) {
+        ++n;
+    }
+    return n;
+#endif
+}
+
+size_t eia608_parity_varify_many(const uint16_t* cc_data, size_t count, uint64_t* failed)
+{
+    size_t i, total = 0;
+
+    for (i = 0; i < count; i += 64) {
+        uint64_t block = eia608_parity_varify_block(&cc_data[i], 64 < count - i ? 64 : count - i);
+        total += eia608_popcount64(block);
+
+        if (failed) {
+            failed[i / 64] = block;
+        }
+    }
+
+    return total;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int eia608_row_map[] = { 10, -1, 0, 1, 2, 3, 11, 12, 13, 14, 4, 5, 6, 7, 8, 9 };
 int eia608_reverse_row_map[] = { 2, 3, 4, 5, 10, 11, 12, 13, 14, 15, 0, 6, 7, 8, 9, 1 };
@@ -46,11 +165,11 @@ const char* eia608_style_map[] = {
 static inline uint16_t eia608_row_pramble(int row, int chan, int x, int underline)
 {
     row = eia608_reverse_row_map[row & 0x0F];
-    return eia608_parity(0x1040 | (chan ? 0x0800 : 0x0000) | ((row << 7) & 0x0700) | ((row << 5) & 0x0020)) | ((x << 1) & 0x001E) | (underline ? 0x0001 : 0x0000);
+    return eia608_parity(0x1040 | (chan ? 0x0800 : 0x0000) | ((row << 7) & 0x0700) | ((row << 5) & 0x0020) | ((x << 1) & 0x001E) | (underline ? 0x0001 : 0x0000));
 }
 
-// row is 0-indexed, 608 spec is 1-indexed
-uint16_t eia608_row_column_pramble(int row, int col, int chan, int underline) { return eia608_row_pramble(row, chan, 0x10 | (col / 4), underline); }
+// row is 0-indexed, 608 spec is 1-indexed. x is 0-7 for a style, or 0x08 plus the column / 4 for an indent
+uint16_t eia608_row_column_pramble(int row, int col, int chan, int underline) { return eia608_row_pramble(row, chan, 0x08 | ((col / 4) & 0x07), underline); }
 uint16_t eia608_row_style_pramble(int row, int chan, eia608_style_t style, int underline) { return eia608_row_pramble(row, chan, style, underline); }
 uint16_t eia608_midrow_change(int chan, eia608_style_t style, int underline) { return eia608_parity(0x1120 | ((chan << 11) & 0x0800) | ((style << 1) & 0x000E) | (underline & 0x0001)); }
 
@@ -108,58 +227,50 @@ uint16_t eia608_control_command(eia608_control_t cmd, int cc)
 }
 ////////////////////////////////////////////////////////////////////////////////
 // text
-static const char* utf8_from_index(int idx) { return (0 <= idx && EIA608_CHAR_COUNT > idx) ? eia608_char_map[idx] : ""; }
+// The character index follows from the class of the word, so the class table is
+// reused here rather than keeping a second table keyed on cc_data
 static int eia608_to_index(uint16_t cc_data, int* chan, int* c1, int* c2)
 {
-    (*c1) = (*c2) = -1;
+    int hi = (cc_data >> 8) & 0x7F, lo = cc_data & 0x7F; // strip off parity bits
+    (*c1) = (*c2) = EIA608_CHAR_COUNT;
     (*chan) = 0;
-    cc_data &= 0x7F7F; // strip off parity bits
 
-    // Handle Basic NA BEFORE we strip the channel bit
-    if (eia608_is_basicna(cc_data)) {
-        // we got first char, yes. But what about second char?
-        (*c1) = (cc_data >> 8) - 0x20;
-        cc_data &= 0x00FF;
+    switch (eia608_class_table[(hi << 7) | lo] & 0x0F) {
+    case eia608_class_basicna:
+        // Basic NA carries no channel bit
+        (*c1) = hi - 0x20;
 
-        if (0x0020 <= cc_data && 0x0080 > cc_data) {
-            (*c2) = cc_data - 0x20;
+        if (0x20 <= lo) {
+            (*c2) = lo - 0x20;
             return 2;
         }
 
         return 1;
-    }
-
-    // Check then strip second channel toggle
-    (*chan) = cc_data & 0x0800;
-    cc_data = cc_data & 0xF7FF;
 
-    if (eia608_is_specialna(cc_data)) {
+    case eia608_class_specialna:
         // Special North American character
-        (*c1) = cc_data - 0x1130 + 0x60;
+        (*chan) = cc_data & 0x0800;
+        (*c1) = 0x60 + (lo & 0x0F);
         return 1;
-    }
 
-    if (0x1220 <= cc_data && 0x1240 > cc_data) {
-        // Extended Western European character set, Spanish/Miscellaneous/French
-        (*c1) = cc_data - 0x1220 + 0x70;
+    case eia608_class_westeu:
+        // Extended Western European character set, 0x12xx Spanish/Miscellaneous/French, 0x13xx Portuguese/German/Danish
+        (*chan) = cc_data & 0x0800;
+        (*c1) = 0x70 + ((hi & 0x01) << 5) + (lo & 0x1F);
         return 1;
-    }
 
-    if (0x1320 <= cc_data && 0x1340 > cc_data) {
-        // Extended Western European character set, Portuguese/German/Danish
-        (*c1) = cc_data - 0x1320 + 0x90;
-        return 1;
+    default:
+        (*chan) = cc_data & 0x0800;
+        return 0;
     }
-
-    return 0;
 }
 
 int eia608_to_utf8(uint16_t c, int* chan, char* str1, char* str2)
 {
     int c1, c2;
-    int size = (int)eia608_to_index(c, chan, &c1, &c2);
-    utf8_char_copy(str1, utf8_from_index(c1));
-    utf8_char_copy(str2, utf8_from_index(c2));
+    int size = eia608_to_index(c, chan, &c1, &c2);
+    memcpy(str1, eia608_utf8_map[c1].data, 5);
+    memcpy(str2, eia608_utf8_map[c2].data, 5);
     return size;
 }
 
@@ -172,8 +283,7 @@ uint16_t eia608_from_basicna(uint16_t bna1, uint16_t bna2)
     return eia608_parity((0xFF00 & bna1) | ((0xFF00 & bna2) >> 8));
 }
 
-// prototype for re2c generated function
-uint16_t _eia608_from_utf8(const utf8_char_t* s);
+// _eia608_from_utf8 looks the character up in the tables of eia608_charmap.c
 uint16_t eia608_from_utf8_1(const utf8_char_t* c, int chan)
 {
     uint16_t cc_data = _eia608_from_utf8(c);
@@ -361,7 +471,7 @@ libcaption_stauts_t cmdlist_from_caption_clear(cc_data_cmdlist_t* cmdlist)
         return LIBCAPTION_ERROR;
     }
 
-    memset(cmdlist, 0, sizeof(cc_data_cmdlist_t));
+    cmdlist_clear(cmdlist);
 
     cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_control_command(eia608_control_erase_display_memory, DEFAULT_CHANNEL));
     cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_control_command(eia608_control_erase_display_memory, DEFAULT_CHANNEL));
@@ -374,7 +484,7 @@ libcaption_stauts_t cmdlist_from_caption_fullreset(cc_data_cmdlist_t* cmdlist)
         return LIBCAPTION_ERROR;
     }
 
-    memset(cmdlist, 0, sizeof(cc_data_cmdlist_t));
+    cmdlist_clear(cmdlist);
 
     cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_control_command(eia608_control_end_of_caption, DEFAULT_CHANNEL));
     cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_control_command(eia608_control_end_of_caption, DEFAULT_CHANNEL));
@@ -391,9 +501,17 @@ libcaption_stauts_t cmdlist_from_streaming_text(cc_data_cmdlist_t* cmdlist, cons
         return LIBCAPTION_ERROR;
     }
 
+    cmdlist_clear(cmdlist);
+    return cmdlist_append_streaming_text(cmdlist, data);
+}
+
+libcaption_stauts_t cmdlist_append_streaming_text(cc_data_cmdlist_t* cmdlist, const utf8_char_t* data) {
+    if (cmdlist == NULL || data == NULL) {
+        return LIBCAPTION_ERROR;
+    }
+
     uint16_t prev_cc_data = 0;
     ssize_t size = (ssize_t)strlen(data);
-    memset(cmdlist, 0, sizeof(cc_data_cmdlist_t));
     // cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_control_command(eia608_control_resume_direct_captioning, DEFAULT_CHANNEL));
     cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_control_command(eia608_control_resume_direct_captioning, DEFAULT_CHANNEL));
 
@@ -444,7 +562,7 @@ libcaption_stauts_t cmdlist_from_streaming_karaoke(cc_data_cmdlist_t* cmdlist, c
 
     uint16_t prev_cc_data = 0;
     ssize_t size = (ssize_t)strlen(data);
-    memset(cmdlist, 0, sizeof(cc_data_cmdlist_t));
+    cmdlist_clear(cmdlist);
     if (*column == 0) {
         cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_control_command(eia608_control_erase_display_memory, DEFAULT_CHANNEL));
         cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_row_column_pramble(13, 0, DEFAULT_CHANNEL, 0));
@@ -503,65 +621,179 @@ libcaption_stauts_t cmdlist_from_streaming_karaoke(cc_data_cmdlist_t* cmdlist, c
     return LIBCAPTION_OK;
 }
 
-libcaption_stauts_t commands_for_frame(cc_data_cmdlist_t* cmdlist, caption_frame_t* frame)
+////////////////////////////////////////////////////////////////////////////////
+// Delta encoding
+// Paint-on edits write straight to displayed memory, so only cells that differ between two frames
+// are sent. The decoder cursor and attributes are tracked to pick the cheapest way to each cell.
+typedef struct {
+    cc_data_cmdlist_t* cmdlist;
+    uint16_t prev_cc_data; // basicna character waiting for a partner
+    int row, col, unl;
+    eia608_style_t styl;
+} eia608_delta_t;
+
+static void eia608_delta_flush(eia608_delta_t* delta)
 {
-    int r, c;
-    int unl, prev_unl;
-    const char* data;
-    uint16_t prev_cc_data;
-    eia608_style_t styl, prev_styl;
+    if (0 != delta->prev_cc_data) {
+        cmdlist_push(delta->cmdlist, 1, cc_type_ntsc_cc_field_1, delta->prev_cc_data);
+        delta->prev_cc_data = 0;
+    }
+}
 
-    if (cmdlist == NULL) {
-        return LIBCAPTION_ERROR;
+static void eia608_delta_push(eia608_delta_t* delta, uint16_t cc_data)
+{
+    const cc_data_t* last;
+
+    eia608_delta_flush(delta);
+    last = cmdlist_peek(delta->cmdlist, delta->cmdlist->length - 1);
+
+    // Repeated control commands are dropped by decoders, so break the repetition with a noop
+    if (last && last->cc_data == cc_data && eia608_is_control(cc_data)) {
+        cmdlist_push(delta->cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_control_command(eia608_control_alarm_off, DEFAULT_CHANNEL));
     }
 
-    memset(cmdlist, 0, sizeof(cc_data_cmdlist_t));
+    cmdlist_push(delta->cmdlist, 1, cc_type_ntsc_cc_field_1, cc_data);
+}
 
-    cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_control_command(eia608_control_resume_caption_loading, DEFAULT_CHANNEL));
-    cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_control_command(eia608_control_resume_caption_loading, DEFAULT_CHANNEL));
+// A tab reaches up to 3 columns right of the cursor, otherwise a preamble and tab are needed.
+// Moving to column 0 can set the attributes of the next cell in the preamble.
+static void eia608_delta_move(eia608_delta_t* delta, int row, int col, eia608_style_t styl, int unl)
+{
+    if (row == delta->row && col >= delta->col && 3 >= col - delta->col) {
+        if (col > delta->col) {
+            eia608_delta_push(delta, eia608_tab(col - delta->col, DEFAULT_CHANNEL));
+        }
+    } else if (0 == col) {
+        eia608_delta_push(delta, eia608_row_style_pramble(row, DEFAULT_CHANNEL, styl, unl));
+        delta->styl = styl, delta->unl = unl;
+    } else {
+        eia608_delta_push(delta, eia608_row_column_pramble(row, col, DEFAULT_CHANNEL, 0));
+        delta->styl = eia608_style_white, delta->unl = 0;
 
-    cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_control_command(eia608_control_erase_non_displayed_memory, DEFAULT_CHANNEL));
-    cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_control_command(eia608_control_erase_non_displayed_memory, DEFAULT_CHANNEL));
+        if (col % 4) {
+            eia608_delta_push(delta, eia608_tab(col % 4, DEFAULT_CHANNEL));
+        }
+    }
 
-    for (r = 0; r < SCREEN_ROWS; ++r) {
-        prev_unl = 0, prev_styl = eia608_style_white;
-        // Calculate preamble
-        for (c = 0; c < SCREEN_COLS && 0 == *caption_frame_read_char(frame, r, c, &styl, &unl); ++c) {
+    delta->row = row, delta->col = col;
+}
+
+static void eia608_delta_write(eia608_delta_t* delta, int row, int col, const utf8_char_t* data, eia608_style_t styl, int unl)
+{
+    eia608_delta_move(delta, row, col, styl, unl);
+
+    if (unl != delta->unl || styl != delta->styl) {
+        eia608_delta_push(delta, eia608_midrow_change(DEFAULT_CHANNEL, styl, unl));
+        delta->styl = styl, delta->unl = unl;
+    }
+
+    push_cc_data(delta->cmdlist, &delta->prev_cc_data, eia608_from_utf8_1(data, DEFAULT_CHANNEL));
+    delta->col = col + 1;
+}
+
+// Returns the number of cells in the row that are kept from prev. A NULL prev is a blank screen
+static int eia608_delta_row(eia608_delta_t* delta, caption_frame_t* prev, caption_frame_t* next, int row)
+{
+    int c, e, i, rest, last, kept = 0;
+    int unl[SCREEN_COLS], prev_unl;
+    eia608_style_t styl[SCREEN_COLS], prev_styl;
+    const utf8_char_t *data[SCREEN_COLS], *prev_data;
+    uint8_t same[SCREEN_COLS];
+
+    for (last = -1, c = 0; c < SCREEN_COLS; ++c) {
+        prev_data = prev ? caption_frame_read_char(prev, row, c, &prev_styl, &prev_unl) : EIA608_CHAR_NULL;
+        data[c] = caption_frame_read_char(next, row, c, &styl[c], &unl[c]);
+        same[c] = 0 == strcmp(prev_data, data[c]) && (0 == *data[c] || (prev_styl == styl[c] && prev_unl == unl[c]));
+        kept += same[c] && *data[c];
+        last = *data[c] ? c : last;
+    }
+
+    for (c = 0; c <= last;) {
+        if (same[c]) {
+            ++c;
+            continue;
         }
 
-        // This row is blank
-        if (SCREEN_COLS == c) {
+        if (*data[c]) {
+            eia608_delta_write(delta, row, c, data[c], styl[c], unl[c]);
+            ++c;
             continue;
         }
 
-        // Write preamble
-        if (0 < c || (0 == unl && eia608_style_white == styl)) {
-            int tab = c % 4;
-            //     cea708_add_cc_data(cea708, 1, cc_type_ntsc_cc_field_1, cc_data);
-            cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_row_column_pramble(r, c, DEFAULT_CHANNEL, 0));
-            if (tab) {
-                cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_tab(tab, DEFAULT_CHANNEL));
+        // Cells to clear before more text. Each backspace clears one cell, but a repeated backspace needs
+        // a noop between. Delete to end of row is one command, but everything after it must be rewritten
+        for (e = c; 0 == *data[e]; ++e) {
+        }
+
+        for (rest = 0, i = e; i <= last; ++i) {
+            rest += same[i] && *data[i];
+        }
+
+        if (2 * (e - c) - 1 <= 1 + (rest + 1) / 2) {
+            eia608_delta_move(delta, row, e, styl[e], unl[e]);
+
+            for (i = c; i < e; ++i) {
+                eia608_delta_push(delta, eia608_control_command(eia608_control_backspace, DEFAULT_CHANNEL));
             }
+
+            delta->col = c;
         } else {
-            cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_row_style_pramble(r, DEFAULT_CHANNEL, styl, unl));
-            prev_unl = unl, prev_styl = styl;
+            eia608_delta_move(delta, row, c, eia608_style_white, 0);
+            eia608_delta_push(delta, eia608_control_command(eia608_control_delete_to_end_of_row, DEFAULT_CHANNEL));
+
+            for (i = e; i < SCREEN_COLS; ++i) {
+                same[i] = 0 == *data[i];
+            }
         }
 
-        // Write the row
-        for (prev_cc_data = 0, data = caption_frame_read_char(frame, r, c, 0, 0);
-             (*data) && c < SCREEN_COLS; ++c, data = caption_frame_read_char(frame, r, c, &styl, &unl)) {
-            uint16_t cc_data = eia608_from_utf8_1(data, DEFAULT_CHANNEL);
+        c = e;
+    }
 
-            if (unl != prev_unl || styl != prev_styl) {
-                cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_midrow_change(DEFAULT_CHANNEL, styl, unl));
-                prev_unl = unl, prev_styl = styl;
-            }
+    // Clear what is left after the end of the new text
+    for (c = last + 1; c < SCREEN_COLS && same[c]; ++c) {
+    }
 
-            push_cc_data(cmdlist, &prev_cc_data, cc_data);
+    if (c < SCREEN_COLS) {
+        if (row != delta->row || last >= delta->col || c < delta->col) {
+            eia608_delta_move(delta, row, last + 1, eia608_style_white, 0);
         }
 
-        if (0 != prev_cc_data) {
-            cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, prev_cc_data);
+        eia608_delta_push(delta, eia608_control_command(eia608_control_delete_to_end_of_row, DEFAULT_CHANNEL));
+    }
+
+    eia608_delta_flush(delta);
+    return kept;
+}
+
+libcaption_stauts_t commands_for_frame(cc_data_cmdlist_t* cmdlist, caption_frame_t* frame)
+{
+    if (cmdlist == NULL) {
+        return LIBCAPTION_ERROR;
+    }
+
+    cmdlist_clear(cmdlist);
+    return cmdlist_append_frame(cmdlist, frame);
+}
+
+libcaption_stauts_t cmdlist_append_frame(cc_data_cmdlist_t* cmdlist, caption_frame_t* frame)
+{
+    int r;
+    eia608_delta_t delta = { cmdlist, 0, -1, 0, 0, eia608_style_white };
+
+    if (cmdlist == NULL) {
+        return LIBCAPTION_ERROR;
+    }
+
+    cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_control_command(eia608_control_resume_caption_loading, DEFAULT_CHANNEL));
+    cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_control_command(eia608_control_resume_caption_loading, DEFAULT_CHANNEL));
+
+    cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_control_command(eia608_control_erase_non_displayed_memory, DEFAULT_CHANNEL));
+    cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, eia608_control_command(eia608_control_erase_non_displayed_memory, DEFAULT_CHANNEL));
+
+    // Non-displayed memory is blank, so each row is written as an edit of a blank row
+    for (r = 0; r < SCREEN_ROWS; ++r) {
+        if (0 != frame->front.row_hash[r]) {
+            eia608_delta_row(&delta, NULL, frame, r);
         }
     }
 
@@ -570,6 +802,66 @@ libcaption_stauts_t commands_for_frame(cc_data_cmdlist_t* cmdlist, caption_frame
     return LIBCAPTION_OK;
 }
 
+libcaption_stauts_t commands_for_frame_delta(cc_data_cmdlist_t* cmdlist, caption_frame_t* prev, caption_frame_t* next)
+{
+    if (cmdlist == NULL) {
+        return LIBCAPTION_ERROR;
+    }
+
+    cmdlist_clear(cmdlist);
+    return cmdlist_append_frame_delta(cmdlist, prev, next);
+}
+
+libcaption_stauts_t cmdlist_append_frame_delta(cc_data_cmdlist_t* cmdlist, caption_frame_t* prev, caption_frame_t* next)
+{
+    int r, kept = 0;
+    size_t start, paint;
+    eia608_delta_t delta = { cmdlist, 0, -1, 0, 0, eia608_style_white };
+
+    if (cmdlist == NULL || next == NULL) {
+        return LIBCAPTION_ERROR;
+    }
+
+    if (prev == NULL) {
+        return cmdlist_append_frame(cmdlist, next);
+    }
+
+    if (0 == caption_frame_hash(next)) {
+        if (0 != caption_frame_hash(prev)) {
+            eia608_delta_push(&delta, eia608_control_command(eia608_control_erase_display_memory, DEFAULT_CHANNEL));
+        }
+
+        return LIBCAPTION_OK;
+    }
+
+    // Encode both ways and keep the shorter one
+    start = cmdlist->length;
+    cmdlist_append_frame(cmdlist, next);
+    paint = cmdlist->length;
+
+    eia608_delta_push(&delta, eia608_control_command(eia608_control_resume_direct_captioning, DEFAULT_CHANNEL));
+
+    for (r = 0; r < SCREEN_ROWS; ++r) {
+        if (prev->front.row_hash[r] == next->front.row_hash[r]) {
+            kept += 0 != next->front.row_hash[r];
+        } else {
+            kept += eia608_delta_row(&delta, prev, next, r);
+        }
+    }
+
+    if (0 > delta.row) {
+        // Nothing changed
+        cmdlist_erase(cmdlist, start, cmdlist->length - start);
+    } else if (0 < kept && cmdlist->length - paint < paint - start) {
+        cmdlist_erase(cmdlist, start, paint - start);
+    } else {
+        // A caption that shares nothing with the last one pops on, so it never appears half drawn
+        cmdlist_erase(cmdlist, paint, cmdlist->length - paint);
+    }
+
+    return LIBCAPTION_OK;
+}
+
 void cmdlist_for_text(cc_data_cmdlist_t* cmdlist, const utf8_char_t* text) {
     if (cmdlist == NULL) {
         return;
@@ -22,6 +22,28 @@
 /* THE SOFTWARE.                                                                              */
 /**********************************************************************************************/
 #include "eia608_charmap.h"
+
+uint16_t _eia608_from_utf8(const utf8_char_t* s)
+{
+    uint32_t codepoint;
+
+    if (!s) {
+        return 0x0000;
+    }
+
+    // ASCII indexes the table directly
+    if (0x80 > (unsigned char)s[0]) {
+        return eia608_from_codepoint[(unsigned char)s[0]];
+    }
+
+    codepoint = utf8_char_codepoint(s);
+    if (EIA608_FROM_CODEPOINT_LIMIT <= codepoint) {
+        return 0x0000;
+    }
+
+    return eia608_from_codepoint[(eia608_from_codepoint_block[codepoint >> 6] << 6) | (codepoint & 0x3F)];
+}
+
 // 0 - 95: Basic North American character set
 // 96 - 111: Special North American character
 // 112 - 127: Extended Western European character set : Extended Spanish/Miscellaneous
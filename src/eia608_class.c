@@ -0,0 +1,1232 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+// Generated by eia608_class.py, do not edit
+#include "eia608.h"
+
+const uint8_t eia608_class_table[EIA608_CLASS_TABLE_SIZE] = {
+    0xc1, 0x82, 0x82, 0xc2, 0x82, 0xc2, 0xc2, 0x82, 0x82, 0xc2, 0xc2, 0x82, 0xc2, 0x82, 0x82, 0xc2,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x42, 0x02, 0x02, 0x42, 0x02, 0x42, 0x42, 0x02, 0x02, 0x42, 0x42, 0x02, 0x42, 0x02, 0x02, 0x42,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x42, 0x02, 0x02, 0x42, 0x02, 0x42, 0x42, 0x02, 0x02, 0x42, 0x42, 0x02, 0x42, 0x02, 0x02, 0x42,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0xc2, 0x82, 0x82, 0xc2, 0x82, 0xc2, 0xc2, 0x82, 0x82, 0xc2, 0xc2, 0x82, 0xc2, 0x82, 0x82, 0xc2,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x42, 0x02, 0x02, 0x42, 0x02, 0x42, 0x42, 0x02, 0x02, 0x42, 0x42, 0x02, 0x42, 0x02, 0x02, 0x42,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0xc2, 0x82, 0x82, 0xc2, 0x82, 0xc2, 0xc2, 0x82, 0x82, 0xc2, 0xc2, 0x82, 0xc2, 0x82, 0x82, 0xc2,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc2, 0x82, 0x82, 0xc2, 0x82, 0xc2, 0xc2, 0x82, 0x82, 0xc2, 0xc2, 0x82, 0xc2, 0x82, 0x82, 0xc2,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x42, 0x02, 0x02, 0x42, 0x02, 0x42, 0x42, 0x02, 0x02, 0x42, 0x42, 0x02, 0x42, 0x02, 0x02, 0x42,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x42, 0x02, 0x02, 0x42, 0x02, 0x42, 0x42, 0x02, 0x02, 0x42, 0x42, 0x02, 0x42, 0x02, 0x02, 0x42,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0xc2, 0x82, 0x82, 0xc2, 0x82, 0xc2, 0xc2, 0x82, 0x82, 0xc2, 0xc2, 0x82, 0xc2, 0x82, 0x82, 0xc2,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc2, 0x82, 0x82, 0xc2, 0x82, 0xc2, 0xc2, 0x82, 0x82, 0xc2, 0xc2, 0x82, 0xc2, 0x82, 0x82, 0xc2,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x42, 0x02, 0x02, 0x42, 0x02, 0x42, 0x42, 0x02, 0x02, 0x42, 0x42, 0x02, 0x42, 0x02, 0x02, 0x42,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0xc2, 0x82, 0x82, 0xc2, 0x82, 0xc2, 0xc2, 0x82, 0x82, 0xc2, 0xc2, 0x82, 0xc2, 0x82, 0x82, 0xc2,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x42, 0x02, 0x02, 0x42, 0x02, 0x42, 0x42, 0x02, 0x02, 0x42, 0x42, 0x02, 0x42, 0x02, 0x02, 0x42,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x42, 0x02, 0x02, 0x42, 0x02, 0x42, 0x42, 0x02, 0x02, 0x42, 0x42, 0x02, 0x42, 0x02, 0x02, 0x42,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0xc2, 0x82, 0x82, 0xc2, 0x82, 0xc2, 0xc2, 0x82, 0x82, 0xc2, 0xc2, 0x82, 0xc2, 0x82, 0x82, 0xc2,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07,
+    0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47,
+    0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47,
+    0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x88, 0xc8, 0xc8, 0x88, 0xc8, 0x88, 0x88, 0xc8, 0xc8, 0x88, 0x88, 0xc8, 0x88, 0xc8, 0xc8, 0x88,
+    0xc5, 0x85, 0x85, 0xc5, 0x85, 0xc5, 0xc5, 0x85, 0x85, 0xc5, 0xc5, 0x85, 0xc5, 0x85, 0x85, 0xc5,
+    0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87,
+    0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7,
+    0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7,
+    0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x86, 0xc6, 0xc6, 0x86, 0xc6, 0x86, 0x86, 0xc6, 0xc6, 0x86, 0x86, 0xc6, 0x86, 0xc6, 0xc6, 0x86,
+    0xc6, 0x86, 0x86, 0xc6, 0x86, 0xc6, 0xc6, 0x86, 0x86, 0xc6, 0xc6, 0x86, 0xc6, 0x86, 0x86, 0xc6,
+    0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87,
+    0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7,
+    0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7,
+    0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x06, 0x46, 0x46, 0x06, 0x46, 0x06, 0x06, 0x46, 0x46, 0x06, 0x06, 0x46, 0x06, 0x46, 0x46, 0x06,
+    0x46, 0x06, 0x06, 0x46, 0x06, 0x46, 0x46, 0x06, 0x06, 0x46, 0x46, 0x06, 0x46, 0x06, 0x06, 0x46,
+    0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07,
+    0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47,
+    0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47,
+    0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x83, 0xc3, 0xc3, 0x83, 0xc3, 0x83, 0x83, 0xc3, 0xc3, 0x83, 0x83, 0xc3, 0x83, 0xc3, 0xc3, 0x83,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87,
+    0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7,
+    0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7,
+    0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x03, 0x43, 0x43, 0x03, 0x43, 0x03, 0x03, 0x43, 0x43, 0x03, 0x03, 0x43, 0x03, 0x43, 0x43, 0x03,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07,
+    0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47,
+    0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47,
+    0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07,
+    0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47,
+    0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47,
+    0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x83, 0xc3, 0xc3, 0x83, 0xc3, 0x83, 0x83, 0xc3, 0xc3, 0x83, 0x83, 0xc3, 0x83, 0xc3, 0xc3, 0x83,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87,
+    0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7,
+    0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7,
+    0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87,
+    0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7,
+    0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7,
+    0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x08, 0x48, 0x48, 0x08, 0x48, 0x08, 0x08, 0x48, 0x48, 0x08, 0x08, 0x48, 0x08, 0x48, 0x48, 0x08,
+    0x45, 0x05, 0x05, 0x45, 0x05, 0x45, 0x45, 0x05, 0x05, 0x45, 0x45, 0x05, 0x45, 0x05, 0x05, 0x45,
+    0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07,
+    0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47,
+    0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47,
+    0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x06, 0x46, 0x46, 0x06, 0x46, 0x06, 0x06, 0x46, 0x46, 0x06, 0x06, 0x46, 0x06, 0x46, 0x46, 0x06,
+    0x46, 0x06, 0x06, 0x46, 0x06, 0x46, 0x46, 0x06, 0x06, 0x46, 0x46, 0x06, 0x46, 0x06, 0x06, 0x46,
+    0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07,
+    0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47,
+    0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47,
+    0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x86, 0xc6, 0xc6, 0x86, 0xc6, 0x86, 0x86, 0xc6, 0xc6, 0x86, 0x86, 0xc6, 0x86, 0xc6, 0xc6, 0x86,
+    0xc6, 0x86, 0x86, 0xc6, 0x86, 0xc6, 0xc6, 0x86, 0x86, 0xc6, 0xc6, 0x86, 0xc6, 0x86, 0x86, 0xc6,
+    0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87,
+    0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7,
+    0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7,
+    0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x03, 0x43, 0x43, 0x03, 0x43, 0x03, 0x03, 0x43, 0x43, 0x03, 0x03, 0x43, 0x03, 0x43, 0x43, 0x03,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07,
+    0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47,
+    0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47,
+    0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x83, 0xc3, 0xc3, 0x83, 0xc3, 0x83, 0x83, 0xc3, 0xc3, 0x83, 0x83, 0xc3, 0x83, 0xc3, 0xc3, 0x83,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87,
+    0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7,
+    0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7,
+    0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89,
+    0xc9, 0x89, 0x89, 0xc9, 0x89, 0xc9, 0xc9, 0x89, 0x89, 0xc9, 0xc9, 0x89, 0xc9, 0x89, 0x89, 0xc9,
+    0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87,
+    0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7,
+    0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7,
+    0x87, 0xc7, 0xc7, 0x87, 0xc7, 0x87, 0x87, 0xc7, 0xc7, 0x87, 0x87, 0xc7, 0x87, 0xc7, 0xc7, 0x87,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09,
+    0x03, 0x43, 0x43, 0x03, 0x43, 0x03, 0x03, 0x43, 0x43, 0x03, 0x03, 0x43, 0x03, 0x43, 0x43, 0x03,
+    0x49, 0x09, 0x09, 0x49, 0x09, 0x49, 0x49, 0x09, 0x09, 0x49, 0x49, 0x09, 0x49, 0x09, 0x09, 0x49,
+    0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07,
+    0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47,
+    0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47,
+    0x07, 0x47, 0x47, 0x07, 0x47, 0x07, 0x07, 0x47, 0x47, 0x07, 0x07, 0x47, 0x07, 0x47, 0x47, 0x07,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4,
+    0x84, 0xc4, 0xc4, 0x84, 0xc4, 0x84, 0x84, 0xc4, 0xc4, 0x84, 0x84, 0xc4, 0x84, 0xc4, 0xc4, 0x84,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44,
+    0x04, 0x44, 0x44, 0x04, 0x44, 0x04, 0x04, 0x44, 0x44, 0x04, 0x04, 0x44, 0x04, 0x44, 0x44, 0x04,
+};
+
+const eia608_utf8_t eia608_utf8_map[EIA608_CHAR_COUNT + 1] = {
+    { { 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0xe2, 0x80, 0x99, 0x00, 0x00, 0x00, 0x00 }, 3 },
+    { { 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0xc3, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0xc3, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0xc3, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0xc3, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xe2, 0x96, 0x88, 0x00, 0x00, 0x00, 0x00 }, 3 },
+    { { 0xc2, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc2, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc2, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc2, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xe2, 0x84, 0xa2, 0x00, 0x00, 0x00, 0x00 }, 3 },
+    { { 0xc2, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc2, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xe2, 0x99, 0xaa, 0x00, 0x00, 0x00, 0x00 }, 3 },
+    { { 0xc3, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc2, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xe2, 0x80, 0x98, 0x00, 0x00, 0x00, 0x00 }, 3 },
+    { { 0xc2, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0xe2, 0x80, 0x94, 0x00, 0x00, 0x00, 0x00 }, 3 },
+    { { 0xc2, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xe2, 0x84, 0xa0, 0x00, 0x00, 0x00, 0x00 }, 3 },
+    { { 0xe2, 0x80, 0xa2, 0x00, 0x00, 0x00, 0x00 }, 3 },
+    { { 0xe2, 0x80, 0x9c, 0x00, 0x00, 0x00, 0x00 }, 3 },
+    { { 0xe2, 0x80, 0x9d, 0x00, 0x00, 0x00, 0x00 }, 3 },
+    { { 0xc3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc2, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc2, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1 },
+    { { 0xc3, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc2, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc2, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc2, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xc3, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00 }, 2 },
+    { { 0xe2, 0x94, 0x8c, 0x00, 0x00, 0x00, 0x00 }, 3 },
+    { { 0xe2, 0x94, 0x90, 0x00, 0x00, 0x00, 0x00 }, 3 },
+    { { 0xe2, 0x94, 0x94, 0x00, 0x00, 0x00, 0x00 }, 3 },
+    { { 0xe2, 0x94, 0x98, 0x00, 0x00, 0x00, 0x00 }, 3 },
+    { { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 0 },
+};
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+# Generates eia608_class.c: python3 eia608_class.py > eia608_class.c
+#
+# The table is indexed by the 14 data bits of a cc_data word (parity bits removed).
+# Bits 0-3 of each entry hold the eia608_class_t of the word, the same class the
+# eia608_is_* tests in eia608.h would give when applied in caption_frame_decode order.
+# Bits 6 and 7 hold the parity bits a valid word must carry in its second and first byte.
+#
+# eia608_utf8_map holds the UTF-8 bytes of each eia608_char_map entry, read from
+# eia608_charmap.c and ../caption/eia608_charmap.h, zero padded to a fixed width.
+# The extra entry at EIA608_CHAR_COUNT is empty and stands for "no character".
+
+import os
+import re
+
+LICENSE = '''/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/'''
+
+CLASSES = [
+    'eia608_class_invalid',
+    'eia608_class_padding',
+    'eia608_class_xds',
+    'eia608_class_control',
+    'eia608_class_basicna',
+    'eia608_class_specialna',
+    'eia608_class_westeu',
+    'eia608_class_preamble',
+    'eia608_class_midrowchange',
+    'eia608_class_unknown',
+]
+
+
+def parity(b: int) -> int:
+    return 0x00 if bin(b).count('1') & 1 else 0x80
+
+
+def classify(cc: int) -> str:
+    if 0x0000 == cc:
+        return 'eia608_class_padding'
+    if 0x0000 == (0x7070 & cc) and 0x0000 != (0x0F0F & cc):
+        return 'eia608_class_xds'
+    if 0x1420 == (0x7670 & cc) or 0x1720 == (0x7770 & cc):
+        return 'eia608_class_control'
+    if 0x0000 != (0x6000 & cc):
+        return 'eia608_class_basicna'
+    if 0x1130 == (0x7770 & cc):
+        return 'eia608_class_specialna'
+    if 0x1220 == (0x7660 & cc):
+        return 'eia608_class_westeu'
+    if 0x1040 == (0x7040 & cc):
+        return 'eia608_class_preamble'
+    if 0x1120 == (0x7770 & cc):
+        return 'eia608_class_midrowchange'
+    return 'eia608_class_unknown'
+
+
+def charmap():
+    here = os.path.dirname(os.path.abspath(__file__))
+    with open(os.path.join(here, '..', 'caption', 'eia608_charmap.h')) as f:
+        defines = dict(re.findall(r'#define (EIA608_CHAR_\w+) "((?:\\x[0-9A-Fa-f]{2})*)"', f.read()))
+    with open(os.path.join(here, 'eia608_charmap.c')) as f:
+        names = re.findall(r'^\s+(EIA608_CHAR_\w+),', f.read(), re.M)
+    return [bytes.fromhex(defines[name].replace('\\x', '')) for name in names]
+
+
+if __name__ == '__main__':
+    print(LICENSE)
+    print('// Generated by eia608_class.py, do not edit')
+    print('#include "eia608.h"')
+    print()
+    print('const uint8_t eia608_class_table[EIA608_CLASS_TABLE_SIZE] = {')
+
+    for hi in range(0x80):
+        row = []
+        for lo in range(0x80):
+            bits = (parity(hi) << 0) | (parity(lo) >> 1)
+            row.append(f'0x{bits | CLASSES.index(classify((hi << 8) | lo)):02x},')
+        for i in range(0, len(row), 16):
+            print('    ' + ' '.join(row[i:i + 16]))
+
+    print('};')
+    print()
+    print('const eia608_utf8_t eia608_utf8_map[EIA608_CHAR_COUNT + 1] = {')
+
+    for utf8 in charmap() + [b'']:
+        data = ', '.join(f'0x{b:02x}' for b in utf8.ljust(7, b'\0'))
+        print(f'    {{ {{ {data} }}, {len(utf8)} }},')
+
+    print('};')
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+# Generates from_utf8.c: python3 from_utf8.py > from_utf8.c
+#
+# Maps unicode codepoints to EIA-608 cc_data and CEA-708 character codes with a two level
+# table. The first level is indexed by codepoint >> 6 and selects a block of 64 entries in
+# the second level. Identical blocks are shared. The first two blocks always hold the ASCII
+# range in order, so a single byte character can index the second level directly.
+#
+# The 608 mapping is the inverse of eia608_char_map. Where a character appears more than
+# once the first (basic) position wins. The 708 mapping comes from cea708_charmap.py.
+
+from cea708_charmap import SPECIALS
+from eia608_class import LICENSE, charmap
+
+BLOCK = 64
+LIMIT = 0x2700  # EIA608_FROM_CODEPOINT_LIMIT, CEA708_FROM_CODEPOINT_LIMIT
+
+# ASCII characters with no basic 608 equivalent, mapped to the nearest extended character
+EIA608_ALIASES = {
+    0x60: 0x1226,  # GRAVE ACCENT -> LEFT SINGLE QUOTATION MARK
+}
+
+
+def eia608_cc_data(index: int) -> int:
+    if 96 > index:
+        return (0x20 + index) << 8  # Basic North American character set
+    if 112 > index:
+        return 0x1130 + index - 96  # Special North American character set
+    if 144 > index:
+        return 0x1220 + index - 112  # Extended Spanish/Miscellaneous/French
+    return 0x1320 + index - 144  # Extended Portuguese/German/Danish
+
+
+def eia608_map() -> dict:
+    out = dict(EIA608_ALIASES)
+    for index, utf8 in enumerate(charmap()):
+        out.setdefault(ord(utf8.decode('utf-8')), eia608_cc_data(index))
+    return out
+
+
+def cea708_map() -> dict:
+    out = {p: p for p in range(0x20, 0x7F)}
+    out[ord('♪')] = 0x7F
+    for code, char in SPECIALS.items():
+        out.setdefault(ord(char), code)
+    return out
+
+
+def table(name: str, mapping: dict):
+    assert LIMIT > max(mapping)
+    blocks = [tuple(mapping.get(b * BLOCK + i, 0) for i in range(BLOCK)) for b in range(LIMIT // BLOCK)]
+    order = blocks[:2]
+    index = []
+    for block in blocks:
+        if block not in order:
+            order.append(block)
+        index.append(order.index(block))
+    assert 0x100 > len(order)
+
+    print(f'const uint8_t {name}_block[{name.upper()}_LIMIT >> 6] = {{')
+    for i in range(0, len(index), 16):
+        print('    ' + ' '.join(f'{b},' for b in index[i:i + 16]))
+    print('};')
+    print()
+    print(f'const uint16_t {name}[{len(order) * BLOCK}] = {{')
+    for block in order:
+        for i in range(0, BLOCK, 8):
+            print('    ' + ' '.join(f'0x{c:04x},' for c in block[i:i + 8]))
+    print('};')
+
+
+if __name__ == '__main__':
+    print(LICENSE)
+    print('// Generated by from_utf8.py, do not edit')
+    print('#include "cea708_charmap.h"')
+    print('#include "eia608_charmap.h"')
+    print()
+    table('eia608_from_codepoint', eia608_map())
+    print()
+    table('cea708_from_codepoint', cea708_map())
@@ -90,7 +90,7 @@ static size_t _copy_to_rbsp(uint8_t* destData, size_t destSize, const uint8_t* s
     return 0;
 }
 ////////////////////////////////////////////////////////////////////////////////
-static inline size_t _find_emulated(uint8_t* data, size_t size)
+static inline size_t _find_emulated(const uint8_t* data, size_t size)
 {
     size_t offset = 2;
 
@@ -113,7 +113,7 @@ static inline size_t _find_emulated(uint8_t* data, size_t size)
     return size;
 }
 
-size_t _copy_from_rbsp(uint8_t* data, uint8_t* payloadData, size_t payloadSize)
+size_t _copy_from_rbsp(uint8_t* data, const uint8_t* payloadData, size_t payloadSize)
 {
     size_t total = 0;
 
@@ -262,6 +262,38 @@ void sei_dump_messages(sei_message_t* head, double timestamp)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
+size_t sei_message_render_size(sei_msgtype_t type, size_t size)
+{
+    return (1 + (type / 255)) + (1 + (size / 255)) + (1 + (size * 4 / 3));
+}
+
+size_t sei_message_render(sei_msgtype_t type, const uint8_t* payload, size_t payload_size, uint8_t* data)
+{
+    size_t escaped_size, size = 0;
+    int payloadType = type;
+    int payloadSize = (int)payload_size;
+
+    while (255 <= payloadType) {
+        data[size++] = 255;
+        payloadType -= 255;
+    }
+
+    data[size++] = payloadType;
+
+    while (255 <= payloadSize) {
+        data[size++] = 255;
+        payloadSize -= 255;
+    }
+
+    data[size++] = payloadSize;
+
+    if (0 >= (escaped_size = _copy_from_rbsp(&data[size], payload, payload_size))) {
+        return 0;
+    }
+
+    return size + escaped_size;
+}
+
 size_t sei_render_size(sei_t* sei)
 {
     if (!sei || !sei->head) {
@@ -271,9 +303,7 @@ size_t sei_render_size(sei_t* sei)
     size_t size = 2; // nalu_type + stop bit
     sei_message_t* msg;
     for (msg = sei_message_head(sei); msg; msg = sei_message_next(msg)) {
-        size += 1 + (msg->type / 255);
-        size += 1 + (msg->size / 255);
-        size += 1 + (msg->size * 4 / 3);
+        size += sei_message_render_size(msg->type, msg->size);
     }
 
     return size;
@@ -286,44 +316,18 @@ size_t sei_render(sei_t* sei, uint8_t* data)
         return 0;
     }
 
-    size_t escaped_size, size = 2; // nalu_type + stop bit
+    size_t message_size, size = 2; // nalu_type + stop bit
     sei_message_t* msg;
     (*data) = 6;
     ++data;
 
     for (msg = sei_message_head(sei); msg; msg = sei_message_next(msg)) {
-        int payloadType = sei_message_type(msg);
-        int payloadSize = (int)sei_message_size(msg);
-        uint8_t* payloadData = sei_message_data(msg);
-
-        while (255 <= payloadType) {
-            (*data) = 255;
-            ++data;
-            ++size;
-            payloadType -= 255;
-        }
-
-        (*data) = payloadType;
-        ++data;
-        ++size;
-
-        while (255 <= payloadSize) {
-            (*data) = 255;
-            ++data;
-            ++size;
-            payloadSize -= 255;
-        }
-
-        (*data) = payloadSize;
-        ++data;
-        ++size;
-
-        if (0 >= (escaped_size = _copy_from_rbsp(data, payloadData, payloadSize))) {
+        if (0 == (message_size = sei_message_render(sei_message_type(msg), sei_message_data(msg), sei_message_size(msg), data))) {
             return 0;
         }
 
-        data += escaped_size;
-        size += escaped_size;
+        data += message_size;
+        size += message_size;
     }
 
     // write stop bit and return
@@ -495,6 +499,12 @@ libcaption_stauts_t sei_from_caption_frame(sei_t* sei, caption_frame_t* frame)
             uint16_t cc_data = eia608_from_utf8_1(data, DEFAULT_CHANNEL);
 
             if (unl != prev_unl || styl != prev_styl) {
+                // A character waiting to be paired must be sent before the style changes
+                if (0 != prev_cc_data) {
+                    sei_encode_eia608(sei, &cea708, prev_cc_data);
+                    prev_cc_data = 0;
+                }
+
                 sei_encode_eia608(sei, &cea708, eia608_midrow_change(DEFAULT_CHANNEL, styl, unl));
                 prev_unl = unl, prev_styl = styl;
             }
@@ -743,6 +753,162 @@ size_t mpeg_bitstream_parse(mpeg_bitstream_t* packet, caption_frame_t* frame, co
 
     return size;
 }
+////////////////////////////////////////////////////////////////////////////////
+// checkpoints
+static void _mpeg_bitstream_cea708_checkpoint(checkpoint_t* cp, cea708_t* cea708)
+{
+    uint8_t country = (uint8_t)cea708->country;
+    uint16_t provider = (uint16_t)cea708->provider;
+    uint8_t flags = cea708->user_data.process_em_data_flag | (cea708->user_data.process_cc_data_flag << 1) | (cea708->user_data.additional_data_flag << 2);
+    uint8_t cc_count = cea708->user_data.cc_count;
+    uint8_t em_data = cea708->user_data.em_data;
+
+    checkpoint_u8(cp, &country);
+    checkpoint_u16(cp, &provider);
+    checkpoint_u32(cp, &cea708->user_identifier);
+    checkpoint_u8(cp, &cea708->user_data_type_code);
+    checkpoint_u8(cp, &cea708->directv_user_data_length);
+    checkpoint_u8(cp, &flags);
+    checkpoint_u8(cp, &em_data);
+    checkpoint_u8(cp, &cc_count);
+    checkpoint_double(cp, &cea708->timestamp);
+
+    if (31 < cc_count) {
+        checkpoint_fail(cp);
+        return;
+    }
+
+    for (int i = 0; i < cc_count; ++i) {
+        cc_data_t* cc = &cea708->user_data.cc_data[i];
+        uint8_t head = (cc->marker_bits << 3) | (cc->cc_valid << 2) | cc->cc_type;
+        uint16_t cc_data = cc->cc_data;
+        checkpoint_u8(cp, &head);
+        checkpoint_u16(cp, &cc_data);
+        cc->marker_bits = head >> 3;
+        cc->cc_valid = (head >> 2) & 0x01;
+        cc->cc_type = head & 0x03;
+        cc->cc_data = cc_data;
+    }
+
+    cea708->country = (itu_t_t35_country_code_t)country;
+    cea708->provider = (itu_t_t35_provider_code_t)provider;
+    cea708->user_data.process_em_data_flag = flags & 0x01;
+    cea708->user_data.process_cc_data_flag = (flags >> 1) & 0x01;
+    cea708->user_data.additional_data_flag = (flags >> 2) & 0x01;
+    cea708->user_data.em_data = em_data;
+    cea708->user_data.cc_count = cc_count;
+}
+
+libcaption_stauts_t mpeg_bitstream_checkpoint(checkpoint_t* cp, mpeg_bitstream_t* packet)
+{
+    uint32_t size = (uint32_t)packet->size;
+    uint8_t status = (uint8_t)packet->status;
+    uint8_t latent = (uint8_t)packet->latent;
+
+    checkpoint_u32(cp, &size);
+
+    if (MAX_NALU_SIZE < size) {
+        return checkpoint_fail(cp);
+    }
+
+    checkpoint_bytes(cp, &packet->data[0], size);
+    checkpoint_double(cp, &packet->dts);
+    checkpoint_double(cp, &packet->cts);
+    checkpoint_u8(cp, &status);
+    checkpoint_u8(cp, &latent);
+
+    if (MAX_REFRENCE_FRAMES < latent || LIBCAPTION_READY < status) {
+        return checkpoint_fail(cp);
+    }
+
+    // The queue is stored in order, so it is loaded starting at the first slot
+    if (checkpoint_loading(cp)) {
+        packet->front = 0;
+    }
+
+    for (size_t i = 0; i < latent; ++i) {
+        _mpeg_bitstream_cea708_checkpoint(cp, _mpeg_bitstream_cea708_at(packet, i));
+    }
+
+    if (checkpoint_loading(cp)) {
+        packet->size = size;
+        packet->status = (libcaption_stauts_t)status;
+        packet->latent = latent;
+    }
+
+    return cp->status;
+}
+
+size_t mpeg_bitstream_save(mpeg_bitstream_t* packet, caption_frame_t* frame, dtvcc_packet_t* dtvcc, uint8_t* dtvcc_pos, uint8_t* data, size_t size)
+{
+    size_t open;
+    checkpoint_t cp;
+    uint8_t end = checkpoint_section_end;
+
+    checkpoint_init_save(&cp, data, size);
+    checkpoint_header(&cp);
+
+    if (frame) {
+        open = checkpoint_section_open(&cp, checkpoint_section_caption_frame);
+        caption_frame_checkpoint(&cp, frame);
+        checkpoint_section_close(&cp, open);
+    }
+
+    if (packet) {
+        open = checkpoint_section_open(&cp, checkpoint_section_mpeg_bitstream);
+        mpeg_bitstream_checkpoint(&cp, packet);
+        checkpoint_section_close(&cp, open);
+    }
+
+    if (dtvcc && dtvcc_pos) {
+        open = checkpoint_section_open(&cp, checkpoint_section_dtvcc_packet);
+        dtvcc_packet_checkpoint(&cp, dtvcc, dtvcc_pos);
+        checkpoint_section_close(&cp, open);
+    }
+
+    checkpoint_u8(&cp, &end);
+    return LIBCAPTION_ERROR == cp.status ? 0 : cp.pos;
+}
+
+libcaption_stauts_t mpeg_bitstream_load(mpeg_bitstream_t* packet, caption_frame_t* frame, dtvcc_packet_t* dtvcc, uint8_t* dtvcc_pos, const uint8_t* data, size_t size)
+{
+    checkpoint_t cp, body;
+    checkpoint_section_t section;
+
+    checkpoint_init_load(&cp, data, size);
+
+    if (LIBCAPTION_OK != checkpoint_header(&cp)) {
+        return LIBCAPTION_ERROR;
+    }
+
+    while (LIBCAPTION_OK == checkpoint_section_next(&cp, &section, &body) && checkpoint_section_end != section) {
+        switch (section) {
+        case checkpoint_section_caption_frame:
+            if (frame && LIBCAPTION_OK != caption_frame_checkpoint(&body, frame)) {
+                return LIBCAPTION_ERROR;
+            }
+            break;
+
+        case checkpoint_section_mpeg_bitstream:
+            if (packet && LIBCAPTION_OK != mpeg_bitstream_checkpoint(&body, packet)) {
+                return LIBCAPTION_ERROR;
+            }
+            break;
+
+        case checkpoint_section_dtvcc_packet:
+            if (dtvcc && dtvcc_pos && LIBCAPTION_OK != dtvcc_packet_checkpoint(&body, dtvcc, dtvcc_pos)) {
+                return LIBCAPTION_ERROR;
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    return cp.status;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // // h262
 // libcaption_stauts_t h262_user_data_to_caption_frame(caption_frame_t* frame, mpeg_bitstream_t* packet, double dts, double cts)
@@ -0,0 +1,146 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "rollup_encoder.h"
+#include "eia608.h"
+#include <string.h>
+
+static const eia608_control_t rollup_encoder_mode[] = { eia608_control_roll_up_2, eia608_control_roll_up_3, eia608_control_roll_up_4 };
+
+void rollup_encoder_init(rollup_encoder_t* enc, int rows, int row)
+{
+    memset(enc, 0, sizeof(rollup_encoder_t));
+    rows = 2 > rows ? 2 : 4 < rows ? 4 : rows;
+    row = rows - 1 > row ? rows - 1 : SCREEN_ROWS <= row ? SCREEN_ROWS - 1 : row;
+    enc->rows = (uint8_t)rows;
+    enc->row = (uint8_t)row;
+}
+
+static void rollup_encoder_push(cc_data_cmdlist_t* cmdlist, uint16_t cc_data)
+{
+    cmdlist_push(cmdlist, 1, cc_type_ntsc_cc_field_1, cc_data);
+}
+
+libcaption_stauts_t rollup_encoder_flush(rollup_encoder_t* enc, cc_data_cmdlist_t* cmdlist)
+{
+    if (!enc || !cmdlist) {
+        return LIBCAPTION_ERROR;
+    }
+
+    if (0 != enc->prev_cc_data) {
+        rollup_encoder_push(cmdlist, enc->prev_cc_data);
+        enc->prev_cc_data = 0;
+    }
+
+    return LIBCAPTION_OK;
+}
+
+// Every line repeats the roll-up mode and base row, so a decoder that joins late recovers at the next line
+static void rollup_encoder_break(rollup_encoder_t* enc, cc_data_cmdlist_t* cmdlist)
+{
+    rollup_encoder_flush(enc, cmdlist);
+    rollup_encoder_push(cmdlist, eia608_control_command(rollup_encoder_mode[enc->rows - 2], DEFAULT_CHANNEL));
+    rollup_encoder_push(cmdlist, eia608_control_command(eia608_control_carriage_return, DEFAULT_CHANNEL));
+    rollup_encoder_push(cmdlist, eia608_row_column_pramble(enc->row, 0, DEFAULT_CHANNEL, 0));
+    enc->started = 1, enc->col = 0, enc->space = 0;
+}
+
+libcaption_stauts_t rollup_encoder_append(rollup_encoder_t* enc, cc_data_cmdlist_t* cmdlist, const utf8_char_t* data)
+{
+    size_t bytes, chars;
+    const utf8_char_t* end;
+
+    if (!enc || !cmdlist || !data) {
+        return LIBCAPTION_ERROR;
+    }
+
+    while (*data) {
+        if (utf8_char_whitespace(data)) {
+            enc->space = 0 < enc->col;
+            data += utf8_char_length(data);
+            continue;
+        }
+
+        // Length of the word on air, as far as this chunk goes. Characters 608 can not carry are dropped.
+        for (bytes = 0, chars = 0; data[bytes] && !utf8_char_whitespace(&data[bytes]);) {
+            size_t s = utf8_char_length(&data[bytes]);
+            chars += 0 != eia608_from_utf8_1(&data[bytes], DEFAULT_CHANNEL);
+            bytes += s ? s : 1;
+        }
+
+        if (0 == chars) {
+            data += bytes;
+            continue;
+        }
+
+        if (!enc->started || (enc->space && SCREEN_COLS < enc->col + 1 + chars)) {
+            rollup_encoder_break(enc, cmdlist);
+        } else if (enc->space) {
+            push_cc_data(cmdlist, &enc->prev_cc_data, eia608_from_utf8_1(EIA608_CHAR_SPACE, DEFAULT_CHANNEL));
+            enc->col += 1;
+        }
+
+        for (enc->space = 0, end = data + bytes; data < end;) {
+            size_t s = utf8_char_length(data);
+            uint16_t cc_data = eia608_from_utf8_1(data, DEFAULT_CHANNEL);
+
+            if (0 != cc_data) {
+                // Words longer than a line are broken
+                if (SCREEN_COLS <= enc->col) {
+                    rollup_encoder_break(enc, cmdlist);
+                }
+
+                push_cc_data(cmdlist, &enc->prev_cc_data, cc_data);
+                enc->col += 1;
+            }
+
+            data += s ? s : 1;
+        }
+    }
+
+    return LIBCAPTION_OK;
+}
+
+libcaption_stauts_t rollup_encoder_newline(rollup_encoder_t* enc, cc_data_cmdlist_t* cmdlist)
+{
+    if (!enc || !cmdlist) {
+        return LIBCAPTION_ERROR;
+    }
+
+    if (0 < enc->col) {
+        rollup_encoder_break(enc, cmdlist);
+    }
+
+    return LIBCAPTION_OK;
+}
+
+libcaption_stauts_t rollup_encoder_clear(rollup_encoder_t* enc, cc_data_cmdlist_t* cmdlist)
+{
+    if (!enc || !cmdlist) {
+        return LIBCAPTION_ERROR;
+    }
+
+    rollup_encoder_push(cmdlist, eia608_control_command(eia608_control_erase_display_memory, DEFAULT_CHANNEL));
+    enc->started = 0, enc->col = 0, enc->space = 0, enc->prev_cc_data = 0;
+    return LIBCAPTION_OK;
+}
@@ -57,10 +57,44 @@ double scc_time_to_timestamp(int hh, int mm, int ss, int ff)
     return (hh * 3600.0) + (mm * 60.0) + ss + (ff / 29.97);
 }
 
+// Reads up to max decimal or hex digits. Returns the number of digits read
+static int scc_lex_digits(const utf8_char_t** data, int max, int base, int* value)
+{
+    int count, digit;
+
+    for (count = 0, (*value) = 0; count < max; ++count, ++(*data)) {
+        utf8_char_t c = **data;
+
+        if ('0' <= c && '9' >= c) {
+            digit = c - '0';
+        } else if (16 == base && 'a' <= (c | 0x20) && 'f' >= (c | 0x20)) {
+            digit = 10 + (c | 0x20) - 'a';
+        } else {
+            break;
+        }
+
+        (*value) = (*value) * base + digit;
+    }
+
+    return count;
+}
+
+static inline const utf8_char_t* scc_skip_blank(const utf8_char_t* data)
+{
+    while (' ' == (*data) || '\t' == (*data)) {
+        ++data;
+    }
+
+    return data;
+}
+
 // 00:00:25:16  9420 9440 aeae ae79 ef75 2068 6176 e520 79ef 75f2 20f2 ef62 eff4 e9e3 732c 2061 6e64 2049 94fe 9723 ea75 73f4 20f7 616e f420 f4ef 2062 e520 61f7 e573 ef6d e520 e96e 2073 7061 e3e5 ae80 942c 8080 8080 942f
+// Parsed by hand rather than with sscanf, which measures the whole remaining input on every call
 size_t scc_to_608(scc_t** scc, const utf8_char_t* data)
 {
-    size_t llen, size = 0;
+    size_t llen;
+    const utf8_char_t* start = data;
+    const utf8_char_t* pos;
     int v1 = 0, v2 = 0, hh = 0, mm = 0, ss = 0, ff = 0, cc_data = 0;
 
     if (0 == data) {
@@ -72,21 +106,30 @@ size_t scc_to_608(scc_t** scc, const utf8_char_t* data)
     }
 
     // skip 'Scenarist_SCC V1.0' header
-    if (2 == sscanf(data, "Scenarist_SCC V%1d.%1d", &v1, &v2)) {
-        data += 18, size += 18;
+    if (0 == strncmp(data, "Scenarist_SCC V", 15)) {
+        pos = data + 15;
+
+        if (1 == scc_lex_digits(&pos, 1, 10, &v1) && '.' == (*pos++) && 1 == scc_lex_digits(&pos, 1, 10, &v2)) {
+            data += 18;
 
-        if (1 != v1 || 0 != v2) {
-            return 0;
+            if (1 != v1 || 0 != v2) {
+                return 0;
+            }
         }
     }
 
-    // Skip blank lines
-    while(utf8_char_whitespace(data)) {
-        data += 1, size += 1;
+    // Skip blank lines, utf8_char_whitespace counts the terminating null as a space
+    while ((*data) && utf8_char_whitespace(data)) {
+        data += 1;
     }
 
-    if (4 == sscanf(data, "%2d:%2d:%2d%*1[:;]%2d", &hh, &mm, &ss, &ff)) {
-        data += 12, size += 12;
+    pos = data;
+
+    if (scc_lex_digits(&pos, 2, 10, &hh) && ':' == (*pos++)
+        && scc_lex_digits(&pos, 2, 10, &mm) && ':' == (*pos++)
+        && scc_lex_digits(&pos, 2, 10, &ss) && (':' == (*pos) || ';' == (*pos)) && ++pos
+        && scc_lex_digits(&pos, 2, 10, &ff)) {
+        data = scc_skip_blank(pos);
         // Get length of the remaining charcters
         llen = utf8_line_length(data);
         llen = utf8_trimmed_length(data, llen);
@@ -95,13 +138,12 @@ size_t scc_to_608(scc_t** scc, const utf8_char_t* data)
         (*scc)->timestamp = scc_time_to_timestamp(hh, mm, ss, ff);
         (*scc)->cc_size = 0;
 
-
-        while ((*scc)->cc_size < max_cc_count && 1 == sscanf(data, "%04x", &cc_data)) {
+        while ((*scc)->cc_size < max_cc_count && 4 == scc_lex_digits(&data, 4, 16, &cc_data)) {
             (*scc)->cc_data[(*scc)->cc_size] = (uint16_t)cc_data;
             (*scc)->cc_size += 1;
-            data += 5, size += 5;
+            data = scc_skip_blank(data);
         }
     }
 
-    return size;
+    return data - start;
 }
@@ -27,6 +27,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 const utf8_char_t* utf8_char_next(const utf8_char_t* c)
 {
     const utf8_char_t* n = c + utf8_char_length(c);
@@ -48,6 +55,30 @@ size_t utf8_char_length(const utf8_char_t* c)
     return _utf8_char_length[(c[0] >> 3) & 0x1F];
 }
 
+uint32_t utf8_char_codepoint(const utf8_char_t* c)
+{
+    // smallest codepoint that needs each sequence length, to reject overlong forms
+    static const uint32_t _utf8_char_min[] = { 0, 0, 0x80, 0x800, 0x10000 };
+    const unsigned char* s = (const unsigned char*)c;
+    size_t i, length = utf8_char_length(c);
+    uint32_t codepoint;
+
+    if (1 >= length) {
+        return length ? s[0] : 0;
+    }
+
+    codepoint = s[0] & (0x7F >> length);
+    for (i = 1; i < length; ++i) {
+        if (0x80 != (s[i] & 0xC0)) {
+            return 0;
+        }
+
+        codepoint = (codepoint << 6) | (s[i] & 0x3F);
+    }
+
+    return _utf8_char_min[length] <= codepoint ? codepoint : 0;
+}
+
 int utf8_char_whitespace(const utf8_char_t* c)
 {
     // 0x7F is DEL
@@ -196,36 +227,92 @@ int utf8_line_count(const utf8_char_t* data)
 utf8_char_t* utf8_load_text_file(const char* path, size_t* size)
 {
     utf8_char_t* data = NULL;
-    FILE* file = fopen(path, "r");
+    size_t file_size, bytes_read;
+    long end;
+    FILE* file = fopen(path, "rb");
 
-    if (file) {
-        fseek(file, 0, SEEK_END);
-        size_t file_size = ftell(file);
-        fseek(file, 0, SEEK_SET);
-
-        if (0 == (*size) || file_size <= (*size)) {
-            (*size) = 0;
-            data = (utf8_char_t*)malloc(1 + file_size);
-            memset(data, '\0', file_size);
+    if (!file) {
+        return NULL;
+    }
 
-            if (data) {
-                utf8_char_t* pos = data;
-                size_t bytes_read = 0;
+    if (0 != fseek(file, 0, SEEK_END) || 0 > (end = ftell(file)) || 0 != fseek(file, 0, SEEK_SET)) {
+        fclose(file);
+        return NULL;
+    }
 
-                while (0 < (bytes_read = fread(pos, 1, file_size - (*size), file))) {
-                    pos += bytes_read;
-                    (*size) += bytes_read;
-                }
-            }
+    file_size = (size_t)end;
 
-            fclose(file);
+    if ((0 == (*size) || file_size <= (*size)) && (data = (utf8_char_t*)malloc(1 + file_size))) {
+        for ((*size) = 0; (*size) < file_size && 0 < (bytes_read = fread(&data[*size], 1, file_size - (*size), file));) {
+            (*size) += bytes_read;
         }
+
+        data[*size] = 0;
     }
 
-    data[*size] = 0;
+    fclose(file);
     return data;
 }
 
+#if defined(_WIN32)
+const utf8_char_t* utf8_map_text_file(const char* path, size_t* size)
+{
+    (*size) = 0;
+    return utf8_load_text_file(path, size);
+}
+
+void utf8_unmap_text_file(const utf8_char_t* data, size_t size)
+{
+    free((void*)data);
+}
+#else
+const utf8_char_t* utf8_map_text_file(const char* path, size_t* size)
+{
+    struct stat st;
+    uint8_t* view;
+    size_t page = (size_t)sysconf(_SC_PAGESIZE), length;
+    int fd = open(path, O_RDONLY);
+
+    if (0 > fd) {
+        return NULL;
+    }
+
+    if (0 != fstat(fd, &st) || 0 > st.st_size) {
+        close(fd);
+        return NULL;
+    }
+
+    // Reserve the file rounded up to a page, plus a guard page of zeros, then map the file
+    // over the front. Whatever follows the last byte of the file reads as zero.
+    (*size) = (size_t)st.st_size;
+    length = (((*size) + page - 1) / page + 1) * page;
+    view = (uint8_t*)mmap(NULL, length, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (MAP_FAILED == view) {
+        close(fd);
+        return NULL;
+    }
+
+    if (0 < (*size) && MAP_FAILED == mmap(view, (*size), PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0)) {
+        munmap(view, length);
+        close(fd);
+        return NULL;
+    }
+
+    close(fd);
+    return (const utf8_char_t*)view;
+}
+
+void utf8_unmap_text_file(const utf8_char_t* data, size_t size)
+{
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+
+    if (data) {
+        munmap((void*)data, ((size + page - 1) / page + 1) * page);
+    }
+}
+#endif
+
 #ifndef strnstr
 char* strnstr(const char* string1, const char* string2, size_t len)
 {
@@ -23,11 +23,96 @@
 /**********************************************************************************************/
 #include "vtt.h"
 #include "utf8.h"
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
 
-vtt_block_t* vtt_block_free_head(vtt_block_t* head);
+// Blocks are bump allocated from chunks owned by the vtt_t. Each chunk counts the blocks
+// still linked from it, so consuming cues from the head releases memory as it goes
+#define VTT_CHUNK_SIZE (64 * 1024)
+#define VTT_ALIGN(SIZE) (((SIZE) + 7) & ~((size_t)7))
+
+typedef struct _vtt_chunk_t {
+    struct _vtt_chunk_t* prev;
+    struct _vtt_chunk_t* next;
+    size_t refs; // blocks allocated from this chunk that have not been freed
+    size_t size;
+    size_t used;
+} vtt_chunk_t;
+
+static inline uint8_t* vtt_chunk_data(vtt_chunk_t* chunk) { return (uint8_t*)chunk + VTT_ALIGN(sizeof(vtt_chunk_t)); }
+
+static void vtt_chunk_free(vtt_t* vtt, vtt_chunk_t* chunk)
+{
+    if (chunk->prev) {
+        chunk->prev->next = chunk->next;
+    } else {
+        vtt->chunk_head = chunk->next;
+    }
+
+    if (chunk->next) {
+        chunk->next->prev = chunk->prev;
+    }
+
+    free(chunk);
+}
+
+static void* vtt_chunk_alloc(vtt_t* vtt, size_t size)
+{
+    vtt_chunk_t* chunk = vtt->chunk_head;
+    size = VTT_ALIGN(size);
+
+    if (!chunk || chunk->size - chunk->used < size) {
+        size_t chunk_size = VTT_CHUNK_SIZE < size ? size : VTT_CHUNK_SIZE;
+
+        if (!(chunk = (vtt_chunk_t*)malloc(VTT_ALIGN(sizeof(vtt_chunk_t)) + chunk_size))) {
+            return NULL;
+        }
+
+        chunk->prev = NULL;
+        chunk->next = vtt->chunk_head;
+        chunk->refs = 0;
+        chunk->size = chunk_size;
+        chunk->used = 0;
+
+        if (vtt->chunk_head) {
+            vtt->chunk_head->prev = chunk;
+        }
+
+        vtt->chunk_head = chunk;
+
+        // The old head is no longer allocated from, release it if nothing lives there
+        if (chunk->next && 0 == chunk->next->refs) {
+            vtt_chunk_free(vtt, chunk->next);
+        }
+    }
+
+    ++chunk->refs;
+    chunk->used += size;
+    return vtt_chunk_data(chunk) + chunk->used - size;
+}
+
+static vtt_block_t* vtt_block_free_head(vtt_t* vtt, vtt_block_t* head)
+{
+    vtt_block_t* next = head->next;
+    vtt_chunk_t* chunk = head->chunk;
+
+    if (0 == --chunk->refs) {
+        if (chunk == vtt->chunk_head) {
+            chunk->used = 0; // still the current chunk, start over
+        } else {
+            vtt_chunk_free(vtt, chunk);
+        }
+    }
+
+    return next;
+}
 
 vtt_t* vtt_new()
 {
@@ -41,27 +126,47 @@ void vtt_free(vtt_t* vtt)
     if (vtt == NULL) {
         return;
     }
-    while (vtt->region_head != NULL) {
-        vtt->region_head = vtt_block_free_head(vtt->region_head);
-    }
-    while (vtt->style_head != NULL) {
-        vtt->style_head = vtt_block_free_head(vtt->style_head);
-    }
-    while (vtt->cue_head != NULL) {
-        vtt->cue_head = vtt_block_free_head(vtt->cue_head);
+
+    while (vtt->chunk_head != NULL) {
+        vtt_chunk_free(vtt, vtt->chunk_head);
     }
+
     free(vtt);
 }
 
-vtt_block_t* vtt_block_new(vtt_t* vtt, const utf8_char_t* data, size_t size, enum VTT_BLOCK_TYPE type)
+static utf8_char_t* vtt_block_copy(utf8_char_t* dest, const utf8_char_t* data, size_t size)
+{
+    if (data) {
+        memcpy(dest, data, size);
+    } else {
+        memset(dest, 0, size);
+    }
+
+    dest[size] = '\0';
+    return dest;
+}
+
+// cue_id and cue_settings are copied into the same allocation as the block
+static vtt_block_t* _vtt_block_new(vtt_t* vtt, const utf8_char_t* data, size_t size, enum VTT_BLOCK_TYPE type,
+    const utf8_char_t* cue_id, size_t cue_id_size, const utf8_char_t* cue_settings, size_t cue_settings_size)
 {
-    vtt_block_t* block = malloc(sizeof(vtt_block_t) + size + 1);
+    size_t total = sizeof(vtt_block_t) + size + 1;
+    total += cue_id ? cue_id_size + 1 : 0;
+    total += cue_settings ? cue_settings_size + 1 : 0;
+
+    vtt_block_t* block = vtt_chunk_alloc(vtt, total);
+
+    if (!block) {
+        return NULL;
+    }
+
     block->next = NULL;
     block->type = type;
     block->timestamp = 0.0;
     block->duration = 0.0;
     block->cue_settings = NULL;
     block->cue_id = NULL;
+    block->chunk = vtt->chunk_head;
     block->text_size = size;
 
     switch (type) {
@@ -93,33 +198,28 @@ vtt_block_t* vtt_block_new(vtt_t* vtt, const utf8_char_t* data, size_t size, enu
         break;
     }
 
-    utf8_char_t* dest = (utf8_char_t*)vtt_block_data(block);
-    if (data) {
-        memcpy(dest, data, size);
-    } else {
-        memset(dest, 0, size);
+    utf8_char_t* dest = vtt_block_copy((utf8_char_t*)vtt_block_data(block), data, size) + size + 1;
+
+    if (cue_id) {
+        block->cue_id = vtt_block_copy(dest, cue_id, cue_id_size);
+        dest += cue_id_size + 1;
+    }
+
+    if (cue_settings) {
+        block->cue_settings = vtt_block_copy(dest, cue_settings, cue_settings_size);
     }
 
-    dest[size] = '\0';
     return block;
 }
 
-vtt_block_t* vtt_block_free_head(vtt_block_t* head)
+vtt_block_t* vtt_block_new(vtt_t* vtt, const utf8_char_t* data, size_t size, enum VTT_BLOCK_TYPE type)
 {
-    vtt_block_t* next = head->next;
-    if (head->cue_id != NULL) {
-        free(head->cue_id);
-    }
-    if (head->cue_settings != NULL) {
-        free(head->cue_settings);
-    }
-    free(head);
-    return next;
+    return _vtt_block_new(vtt, data, size, type, NULL, 0, NULL, 0);
 }
 
 void vtt_cue_free_head(vtt_t* vtt)
 {
-    vtt->cue_head = vtt_block_free_head(vtt->cue_head);
+    vtt->cue_head = vtt_block_free_head(vtt, vtt->cue_head);
     if (vtt->cue_head == NULL) {
         vtt->cue_tail = NULL;
     }
@@ -127,7 +227,7 @@ void vtt_cue_free_head(vtt_t* vtt)
 
 void vtt_style_free_head(vtt_t* vtt)
 {
-    vtt->style_head = vtt_block_free_head(vtt->style_head);
+    vtt->style_head = vtt_block_free_head(vtt, vtt->style_head);
     if (vtt->style_head == NULL) {
         vtt->style_tail = NULL;
     }
@@ -135,52 +235,121 @@ void vtt_style_free_head(vtt_t* vtt)
 
 void vtt_region_free_head(vtt_t* vtt)
 {
-    vtt->region_head = vtt_block_free_head(vtt->region_head);
+    vtt->region_head = vtt_block_free_head(vtt, vtt->region_head);
     if (vtt->region_head == NULL) {
         vtt->region_tail = NULL;
     }
 }
 
 #define VTTTIME2SECONDS(HH, MM, SS, MS) ((HH * 3600.0) + (MM * 60.0) + SS + (MS / 1000.0))
-double parse_timestamp(const utf8_char_t* line)
+#define VTT_IS_DIGIT(C) ('0' <= (C) && '9' >= (C))
+#define VTT_IS_SPACE(C) (' ' == (C) || '\t' == (C))
+#define VTT_IS_EOL(C) ('\0' == (C) || '\r' == (C) || '\n' == (C))
+
+// Reads up to max digits, max of 0 means no limit. Returns the number of digits read
+static int vtt_lex_digits(const utf8_char_t** line, int max, int* value)
 {
-    int hh, mm, ss, ms;
-    if (sscanf(line, "%d:%2d:%2d%*1[,.]%3d", &hh, &mm, &ss, &ms) == 4) {
-        return VTTTIME2SECONDS(hh, mm, ss, ms);
-    }
-    if (sscanf(line, "%2d:%2d%*1[,.]%3d", &mm, &ss, &ms) == 3) {
-        return VTTTIME2SECONDS(0.0, mm, ss, ms);
+    int count = 0;
+
+    for ((*value) = 0; VTT_IS_DIGIT(**line) && (!max || count < max); ++(*line), ++count) {
+        (*value) = (*value) * 10 + (**line - '0');
     }
-    return -1.0;
+
+    return count;
 }
 
-void parse_timestamps(const utf8_char_t* line, double* start_pts, double* end_pts, char** cue_settings)
+// Reads HH:MM:SS.mmm or MM:SS.mmm, either separator may be ',' for srt
+// Returns a pointer past the timestamp, or NULL if there is none
+static const utf8_char_t* vtt_lex_timestamp(const utf8_char_t* line, double* pts)
 {
-    char start_str[32];
-    char end_str[32];
-    char cue_str[1024];
+    int hh = 0, mm, ss, ms, count;
+
+    if (0 == (count = vtt_lex_digits(&line, 0, &mm)) || ':' != *line++) {
+        return NULL;
+    }
+
+    if (0 == vtt_lex_digits(&line, 2, &ss)) {
+        return NULL;
+    }
+
+    if (':' == *line) {
+        ++line;
+        hh = mm, mm = ss;
+
+        if (0 == vtt_lex_digits(&line, 2, &ss)) {
+            return NULL;
+        }
+    } else if (2 < count) {
+        return NULL;
+    }
+
+    if ('.' != *line && ',' != *line) {
+        return NULL;
+    }
+
+    ++line;
+    if (0 == vtt_lex_digits(&line, 3, &ms)) {
+        return NULL;
+    }
+
+    (*pts) = VTTTIME2SECONDS(hh, mm, ss, ms);
+    return line;
+}
 
-    memset(start_str, 0, sizeof(start_str));
-    memset(end_str, 0, sizeof(end_str));
-    memset(cue_str, 0, sizeof(cue_str));
+double parse_timestamp(const utf8_char_t* line)
+{
+    double pts;
+    return vtt_lex_timestamp(line, &pts) ? pts : -1.0;
+}
 
-    int matches = sscanf(line, " %31s --> %31s%1023[^\n\r]", start_str, end_str, cue_str);
+// Parses "start --> end [settings]" in one pass. The settings are returned as a slice of line
+void parse_timestamps(const utf8_char_t* line, double* start_pts, double* end_pts, const utf8_char_t** cue_settings, size_t* cue_settings_size)
+{
     *start_pts = -1;
     *cue_settings = NULL;
+    *cue_settings_size = 0;
 
-    if (matches >= 1) {
-        *start_pts = parse_timestamp(start_str);
+    while (VTT_IS_SPACE(*line)) {
+        ++line;
     }
-    if (matches >= 2) {
-        *end_pts = parse_timestamp(end_str);
+
+    if (!vtt_lex_timestamp(line, start_pts)) {
+        *start_pts = -1;
     }
-    if (matches == 3) {
-        size_t cue_size = strnlen(cue_str, sizeof(cue_str));
-        if (cue_size > 0) {
-            *cue_settings = malloc(cue_size + 1);
-            strncpy(*cue_settings, cue_str, cue_size + 1);
-        }
+
+    // skip any trailing garbage in the start token
+    while (!VTT_IS_EOL(*line) && !VTT_IS_SPACE(*line)) {
+        ++line;
+    }
+
+    while (VTT_IS_SPACE(*line)) {
+        ++line;
+    }
+
+    if (0 != strncmp(line, "-->", 3)) {
+        return;
+    }
+
+    for (line += 3; VTT_IS_SPACE(*line); ++line) {
+    }
+
+    if (VTT_IS_EOL(*line)) {
+        return;
+    }
+
+    if (!vtt_lex_timestamp(line, end_pts)) {
+        *end_pts = -1;
+    }
+
+    while (!VTT_IS_EOL(*line) && !VTT_IS_SPACE(*line)) {
+        ++line;
     }
+
+    for ((*cue_settings) = line; !VTT_IS_EOL(*line); ++line) {
+    }
+
+    (*cue_settings_size) = line - (*cue_settings);
+    (*cue_settings) = (*cue_settings_size) ? (*cue_settings) : NULL;
 }
 
 vtt_t* vtt_parse(const utf8_char_t* data, size_t size)
@@ -188,40 +357,22 @@ vtt_t* vtt_parse(const utf8_char_t* data, size_t size)
     return _vtt_parse(data, size, 0);
 }
 
-vtt_t* _vtt_parse(const utf8_char_t* data, size_t size, int srt_mode)
+// Parses null terminated data, appending the blocks to vtt. cues is incremented for every cue
+static libcaption_stauts_t _vtt_parse_blocks(vtt_t* vtt, const utf8_char_t* data, size_t* cues)
 {
-    vtt_t* vtt = NULL;
     double str_pts = 0, end_pts = 0;
     size_t line_length = 0, trimmed_length = 0;
-    char* cue_settings;
+    const utf8_char_t* cue_settings = NULL;
+    size_t cue_settings_size = 0;
     enum VTT_BLOCK_TYPE block_type;
     size_t cue_id_length = 0;
     const utf8_char_t* cue_id = NULL;
 
-    if (!data || !size || size < 6) {
-        return NULL;
-    }
-
-    // TODO: Support UTF-8 BOM?
-    if (!srt_mode) {
-        if (strncmp(data, "WEBVTT", 6) != 0) {
-            // WebVTT files must start with WEBVTT
-            fprintf(stderr, "Invalid webvtt header: %.*s\n", 6, data);
-            return NULL;
-        } else {
-            data += 6;
-            size -= 6;
-        }
-    }
-
-    vtt = vtt_new();
-
     for (;;) {
         line_length = 0;
 
         do {
             data += line_length;
-            size -= line_length;
             line_length = utf8_line_length(data); // Line length
             trimmed_length = utf8_trimmed_length(data, line_length);
             // Skip empty lines
@@ -240,29 +391,27 @@ vtt_t* _vtt_parse(const utf8_char_t* data, size_t size, int srt_mode)
             block_type = VTT_NOTE;
         } else if (strnstr(data, "-->", line_length) != NULL) {
             block_type = VTT_CUE;
-            parse_timestamps(data, &str_pts, &end_pts, &cue_settings);
+            parse_timestamps(data, &str_pts, &end_pts, &cue_settings, &cue_settings_size);
             if (str_pts == -1) {
                 // Failed to parse timestamps
                 fprintf(stderr, "Bad timestamp: %.*s\n", (int)line_length, data);
-                return NULL;
+                return LIBCAPTION_ERROR;
             }
         } else {
             if (cue_id != NULL) {
                 // Invalid text found
                 fprintf(stderr, "ERR: Unrecognized block\n");
-                return NULL;
+                return LIBCAPTION_ERROR;
             }
 
             cue_id = data;
             cue_id_length = line_length;
 
             data += line_length;
-            size -= line_length;
             continue;
         }
 
         data += line_length;
-        size -= line_length;
 
         // Caption text starts here
         const utf8_char_t* text = data;
@@ -276,30 +425,181 @@ vtt_t* _vtt_parse(const utf8_char_t* data, size_t size, int srt_mode)
             trimmed_length = utf8_trimmed_length(data, line_length);
             // printf ("cap (%d): '%.*s'\n", line_length, (int) trimmed_length, data);
             data += line_length;
-            size -= line_length;
         } while (trimmed_length);
 
         // should we trim here?
 
-        vtt_block_t* block = vtt_block_new(vtt, text, text_size, block_type);
-
+        // NOTE blocks are not kept, so do not allocate them
         if (block_type == VTT_CUE) {
+            vtt_block_t* block = _vtt_block_new(vtt, text, text_size, block_type, cue_id, cue_id_length, cue_settings, cue_settings_size);
+
+            if (!block) {
+                return LIBCAPTION_ERROR;
+            }
+
             block->timestamp = str_pts;
             block->duration = end_pts - str_pts;
-            block->cue_settings = cue_settings;
-            if (cue_id != NULL) {
-                block->cue_id = malloc(cue_id_length + 1);
-                memcpy(block->cue_id, cue_id, cue_id_length);
-                block->cue_id[cue_id_length] = '\0';
-            }
+            ++(*cues);
+        } else if (block_type != VTT_NOTE && !vtt_block_new(vtt, text, text_size, block_type)) {
+            return LIBCAPTION_ERROR;
         }
 
         cue_id = NULL;
     }
 
+    return LIBCAPTION_OK;
+}
+
+vtt_t* _vtt_parse(const utf8_char_t* data, size_t size, int srt_mode)
+{
+    vtt_t* vtt = NULL;
+    size_t cues = 0;
+
+    if (!data || !size || size < 6) {
+        return NULL;
+    }
+
+    // TODO: Support UTF-8 BOM?
+    if (!srt_mode) {
+        if (strncmp(data, "WEBVTT", 6) != 0) {
+            // WebVTT files must start with WEBVTT
+            fprintf(stderr, "Invalid webvtt header: %.*s\n", 6, data);
+            return NULL;
+        } else {
+            data += 6;
+            size -= 6;
+        }
+    }
+
+    vtt = vtt_new();
+
+    if (LIBCAPTION_OK != _vtt_parse_blocks(vtt, data, &cues)) {
+        vtt_free(vtt);
+        return NULL;
+    }
+
     return vtt;
 }
 
+void vtt_parser_init(vtt_parser_t* parser, vtt_t* vtt, int srt_mode)
+{
+    memset(parser, 0, sizeof(vtt_parser_t));
+    parser->vtt = vtt;
+    parser->srt_mode = srt_mode;
+    parser->header = !srt_mode;
+}
+
+void vtt_parser_free(vtt_parser_t* parser)
+{
+    free(parser->data);
+    memset(parser, 0, sizeof(vtt_parser_t));
+}
+
+static int vtt_parser_blank(const utf8_char_t* data, size_t size)
+{
+    size_t i, length;
+
+    for (i = 0; i < size; i += length ? length : 1) {
+        if (!utf8_char_whitespace(data + i)) {
+            return 0;
+        }
+
+        length = utf8_char_length(data + i);
+    }
+
+    return 1;
+}
+
+// Parses the first size bytes of the buffer as whole blocks, then drops them
+static libcaption_stauts_t vtt_parser_consume(vtt_parser_t* parser, size_t size, size_t* cues)
+{
+    libcaption_stauts_t status = LIBCAPTION_OK;
+    utf8_char_t c = parser->data[size];
+    parser->data[size] = '\0';
+
+    if (parser->header) {
+        // The header block is skipped whole, so "WEBVTT - title" and header metadata are fine
+        if (strncmp(parser->data, "WEBVTT", 6) != 0) {
+            fprintf(stderr, "Invalid webvtt header: %.*s\n", 6, parser->data);
+            status = LIBCAPTION_ERROR;
+        }
+
+        parser->header = 0;
+    } else {
+        status = _vtt_parse_blocks(parser->vtt, parser->data, cues);
+    }
+
+    parser->data[size] = c;
+    parser->size -= size;
+    parser->scan -= size;
+    memmove(parser->data, parser->data + size, parser->size + 1);
+    return status;
+}
+
+libcaption_stauts_t vtt_parser_push(vtt_parser_t* parser, const utf8_char_t* data, size_t size)
+{
+    libcaption_stauts_t status = LIBCAPTION_OK;
+    size_t cues = 0, line, end, newline;
+
+    if (parser->aloc < parser->size + size + 1) {
+        size_t aloc = 2 * parser->aloc < parser->size + size + 1 ? parser->size + size + 1 : 2 * parser->aloc;
+        utf8_char_t* buffer = (utf8_char_t*)realloc(parser->data, aloc);
+
+        if (!buffer) {
+            return LIBCAPTION_ERROR;
+        }
+
+        parser->data = buffer;
+        parser->aloc = aloc;
+    }
+
+    memcpy(parser->data + parser->size, data, size);
+    parser->size += size;
+    parser->data[parser->size] = '\0';
+
+    // Only lines that have not been looked at are scanned, so each byte is examined once
+    for (line = parser->scan; line < parser->size; line = parser->scan) {
+        for (end = line; end < parser->size && '\r' != parser->data[end] && '\n' != parser->data[end]; ++end) {
+        }
+
+        // A lone \r at the end may be the first half of \r\n, wait for the next byte
+        if (end == parser->size || ('\r' == parser->data[end] && end + 1 == parser->size)) {
+            break;
+        }
+
+        newline = ('\r' == parser->data[end] && '\n' == parser->data[end + 1]) || ('\n' == parser->data[end] && '\r' == parser->data[end + 1]) ? 2 : 1;
+        parser->scan = end + newline;
+
+        if (!vtt_parser_blank(parser->data + line, end - line)) {
+            ++parser->lines;
+        } else if (0 < parser->lines) {
+            // A blank line ends the block
+            parser->lines = 0;
+
+            if (LIBCAPTION_OK != vtt_parser_consume(parser, parser->scan, &cues)) {
+                status = LIBCAPTION_ERROR;
+            }
+        }
+    }
+
+    return LIBCAPTION_OK != status ? status : (cues ? LIBCAPTION_READY : LIBCAPTION_OK);
+}
+
+libcaption_stauts_t vtt_parser_flush(vtt_parser_t* parser)
+{
+    libcaption_stauts_t status = LIBCAPTION_OK;
+    size_t cues = 0;
+
+    // The last block may not have been followed by a blank line
+    if (!vtt_parser_blank(parser->data, parser->size)) {
+        status = vtt_parser_consume(parser, parser->size, &cues);
+    }
+
+    parser->size = parser->scan = parser->lines = 0;
+    parser->header = !parser->srt_mode;
+    return LIBCAPTION_OK != status ? status : (cues ? LIBCAPTION_READY : LIBCAPTION_OK);
+}
+
 int vtt_cue_to_caption_frame(vtt_block_t* cue, caption_frame_t* frame)
 {
     const char* data = vtt_block_data(cue);
@@ -312,54 +612,419 @@ vtt_block_t* vtt_cue_from_caption_frame(caption_frame_t* frame, vtt_t* vtt)
         vtt->cue_tail->duration = frame->timestamp - vtt->cue_tail->timestamp;
     }
 
-    // CRLF per row, plus an extra at the end
-    vtt_block_t* cue = vtt_block_new(vtt, NULL, 2 + CAPTION_FRAME_TEXT_BYTES, VTT_CUE);
-    utf8_char_t* data = vtt_block_data(cue);
+    // Render on the stack first so the cue is allocated at its exact size. Most cues are a
+    // line or two, far less than the CRLF per row a full screen would need
+    utf8_char_t text[CAPTION_FRAME_TEXT_BYTES + 2];
+    size_t size = caption_frame_to_text(frame, text);
 
-    caption_frame_to_text(frame, data);
-    cue->timestamp = frame->timestamp;
     // vtt requires an extra new line
-    strcat((char*)data, "\r\n");
+    memcpy(text + size, "\r\n", 2);
+    vtt_block_t* cue = vtt_block_new(vtt, text, size + 2, VTT_CUE);
+
+    if (cue) {
+        cue->timestamp = frame->timestamp;
+    }
+
     return cue;
 }
 
-static void _dump(vtt_t* vtt)
+// Writes hh:mm:ss.ttt (hh:mm:ss,ttt for SRT) from whole milliseconds, returns the length
+static size_t vtt_format_timestamp(char* out, double tt, int srt_mode)
+{
+    int64_t ms = 0 < tt ? (int64_t)(tt * 1000) : 0;
+    int64_t hh = ms / 3600000;
+    char digits[20];
+    size_t size = 0, count = 0;
+
+    do {
+        digits[count++] = (char)('0' + hh % 10);
+        hh /= 10;
+    } while (0 < hh);
+
+    if (1 == count) {
+        out[size++] = '0';
+    }
+
+    while (count) {
+        out[size++] = digits[--count];
+    }
+
+    int mm = (int)(ms / 60000 % 60), ss = (int)(ms / 1000 % 60), ttt = (int)(ms % 1000);
+    out[size++] = ':';
+    out[size++] = (char)('0' + mm / 10);
+    out[size++] = (char)('0' + mm % 10);
+    out[size++] = ':';
+    out[size++] = (char)('0' + ss / 10);
+    out[size++] = (char)('0' + ss % 10);
+    out[size++] = srt_mode ? ',' : '.';
+    out[size++] = (char)('0' + ttt / 100);
+    out[size++] = (char)('0' + ttt / 10 % 10);
+    out[size++] = (char)('0' + ttt % 10);
+    return size;
+}
+
+static int vtt_write_all(int fd, const char* data, size_t size)
+{
+    while (0 < size) {
+#if defined(_WIN32)
+        int bytes = _write(fd, data, (unsigned int)(VTT_WRITER_BUFFER_SIZE < size ? VTT_WRITER_BUFFER_SIZE : size));
+#else
+        ssize_t bytes = write(fd, data, size);
+
+        if (0 > bytes && EINTR == errno) {
+            continue;
+        }
+#endif
+        if (0 >= bytes) {
+            return 0;
+        }
+
+        data += bytes, size -= (size_t)bytes;
+    }
+
+    return 1;
+}
+
+void vtt_writer_init(vtt_writer_t* writer, int fd, int srt_mode)
+{
+    memset(writer, 0, sizeof(vtt_writer_t));
+    writer->fd = fd;
+    writer->srt_mode = srt_mode;
+}
+
+void vtt_writer_free(vtt_writer_t* writer)
+{
+    free(writer->data);
+    memset(writer, 0, sizeof(vtt_writer_t));
+    writer->fd = -1;
+}
+
+static libcaption_stauts_t vtt_writer_reserve(vtt_writer_t* writer, size_t size)
+{
+    if (writer->size + size > writer->aloc) {
+        size_t aloc = writer->aloc ? writer->aloc : VTT_WRITER_BUFFER_SIZE;
+
+        while (writer->size + size > aloc) {
+            aloc *= 2;
+        }
+
+        utf8_char_t* data = (utf8_char_t*)realloc(writer->data, aloc);
+
+        if (!data) {
+            return LIBCAPTION_ERROR;
+        }
+
+        writer->data = data;
+        writer->aloc = aloc;
+    }
+
+    return LIBCAPTION_OK;
+}
+
+// Space must have been reserved
+static void vtt_writer_append(vtt_writer_t* writer, const char* data, size_t size)
+{
+    memcpy(writer->data + writer->size, data, size);
+    writer->size += size;
+}
+
+// Writes to the fd once a full buffer has accumulated
+static libcaption_stauts_t vtt_writer_complete(vtt_writer_t* writer)
+{
+    if (0 <= writer->fd && VTT_WRITER_BUFFER_SIZE <= writer->size) {
+        return vtt_writer_flush(writer);
+    }
+
+    return LIBCAPTION_OK;
+}
+
+libcaption_stauts_t vtt_writer_header(vtt_writer_t* writer, vtt_t* vtt)
 {
     vtt_block_t* block;
-    printf("WEBVTT\r\n\r\n");
 
-    block = vtt->region_head;
-    while (block != NULL) {
-        printf("REGION\r\n%s\r\n", vtt_block_data(block));
-        block = block->next;
+    if (writer->srt_mode) {
+        return LIBCAPTION_OK;
     }
 
-    block = vtt->style_head;
-    while (block != NULL) {
-        printf("STYLE\r\n%s\r\n", vtt_block_data(block));
-        block = block->next;
+    if (LIBCAPTION_OK != vtt_writer_reserve(writer, 10)) {
+        return LIBCAPTION_ERROR;
     }
 
-    block = vtt->cue_head;
-    while (block != NULL) {
-        int hh1, hh2, mm1, mm2, ss1, ss2, ms1, ms2;
-        vtt_crack_time(block->timestamp, &hh1, &mm1, &ss1, &ms1);
-        vtt_crack_time(block->timestamp + block->duration, &hh2, &mm2, &ss2, &ms2);
+    vtt_writer_append(writer, "WEBVTT\r\n\r\n", 10);
+
+    for (int style = 0; style < 2; ++style) {
+        for (block = style ? vtt->style_head : vtt->region_head; block; block = block->next) {
+            const char* data = vtt_block_data(block);
+            size_t size = strlen(data);
+
+            if (LIBCAPTION_OK != vtt_writer_reserve(writer, 10 + size)) {
+                return LIBCAPTION_ERROR;
+            }
 
-        if (block->cue_id != NULL) {
-            printf("%s\n", block->cue_id);
+            vtt_writer_append(writer, style ? "STYLE\r\n" : "REGION\r\n", style ? 7 : 8);
+            vtt_writer_append(writer, data, size);
+            vtt_writer_append(writer, "\r\n", 2);
         }
+    }
+
+    return vtt_writer_complete(writer);
+}
 
-        printf("%02d:%02d:%02d.%03d --> %02d:%02d:%02d.%03d",
-            hh1, mm1, ss1, ms1, hh2, mm2, ss2, ms2);
+libcaption_stauts_t vtt_writer_cue(vtt_writer_t* writer, vtt_block_t* cue)
+{
+    const char* data = vtt_block_data(cue);
+    size_t size = strlen(data);
+    size_t cue_id_size = (!writer->srt_mode && cue->cue_id) ? strlen(cue->cue_id) : 0;
+    const char* cue_settings = cue->cue_settings;
+    size_t cue_settings_size = 0;
+    char timestamp[32];
 
-        if (block->cue_settings != NULL) {
-            printf(" %s", block->cue_settings);
+    // The parser keeps the whitespace that followed the end timestamp
+    if (!writer->srt_mode && cue_settings) {
+        while (VTT_IS_SPACE(*cue_settings)) {
+            ++cue_settings;
         }
 
-        printf("\r\n%s\r\n", vtt_block_data(block));
-        block = block->next;
+        cue_settings_size = strlen(cue_settings);
     }
+
+    // Two timestamps of at most 30 bytes, the cue number, separators and line endings
+    if (LIBCAPTION_OK != vtt_writer_reserve(writer, 96 + cue_id_size + cue_settings_size + size)) {
+        return LIBCAPTION_ERROR;
+    }
+
+    writer->count += 1;
+
+    if (writer->srt_mode) {
+        writer->size += sprintf((char*)writer->data + writer->size, "%02u\r\n", (unsigned int)writer->count);
+    } else if (cue->cue_id) {
+        vtt_writer_append(writer, cue->cue_id, cue_id_size);
+        vtt_writer_append(writer, "\n", 1);
+    }
+
+    vtt_writer_append(writer, timestamp, vtt_format_timestamp(timestamp, cue->timestamp, writer->srt_mode));
+    vtt_writer_append(writer, " --> ", 5);
+    vtt_writer_append(writer, timestamp, vtt_format_timestamp(timestamp, cue->timestamp + cue->duration, writer->srt_mode));
+
+    if (cue_settings_size) {
+        vtt_writer_append(writer, " ", 1);
+        vtt_writer_append(writer, cue_settings, cue_settings_size);
+    }
+
+    vtt_writer_append(writer, "\r\n", 2);
+    vtt_writer_append(writer, data, size);
+    vtt_writer_append(writer, "\r\n", 2);
+    return vtt_writer_complete(writer);
 }
 
-void vtt_dump(vtt_t* head) { _dump(head); }
+libcaption_stauts_t vtt_writer_flush(vtt_writer_t* writer)
+{
+    if (0 > writer->fd || 0 == writer->size) {
+        return LIBCAPTION_OK;
+    }
+
+    // Keep the order of anything already printed
+    if (1 == writer->fd) {
+        fflush(stdout);
+    }
+
+    int ok = vtt_write_all(writer->fd, (const char*)writer->data, writer->size);
+    writer->size = 0;
+    return ok ? LIBCAPTION_OK : LIBCAPTION_ERROR;
+}
+
+libcaption_stauts_t vtt_write(vtt_t* vtt, int fd, int srt_mode)
+{
+    vtt_writer_t writer;
+    vtt_block_t* cue;
+    libcaption_stauts_t status;
+
+    vtt_writer_init(&writer, fd, srt_mode);
+    status = vtt_writer_header(&writer, vtt);
+
+    for (cue = vtt->cue_head; cue && LIBCAPTION_OK == status; cue = cue->next) {
+        status = vtt_writer_cue(&writer, cue);
+    }
+
+    if (LIBCAPTION_OK == status) {
+        status = vtt_writer_flush(&writer);
+    }
+
+    vtt_writer_free(&writer);
+    return status;
+}
+
+void vtt_dump(vtt_t* vtt) { vtt_write(vtt, 1, 0); }
+
+libcaption_stauts_t vtt_emitter_init(vtt_emitter_t* emitter, int fd, int srt_mode)
+{
+    vtt_writer_init(&emitter->writer, fd, srt_mode);
+
+    if (!(emitter->vtt = vtt_new())) {
+        return LIBCAPTION_ERROR;
+    }
+
+    if (LIBCAPTION_OK != vtt_writer_header(&emitter->writer, emitter->vtt)) {
+        return LIBCAPTION_ERROR;
+    }
+
+    return vtt_writer_flush(&emitter->writer);
+}
+
+void vtt_emitter_free(vtt_emitter_t* emitter)
+{
+    vtt_writer_free(&emitter->writer);
+
+    if (emitter->vtt) {
+        vtt_free(emitter->vtt);
+        emitter->vtt = NULL;
+    }
+}
+
+libcaption_stauts_t vtt_emitter_frame(vtt_emitter_t* emitter, caption_frame_t* frame)
+{
+    vtt_t* vtt = emitter->vtt;
+    libcaption_stauts_t status = LIBCAPTION_OK;
+
+    // Gives the pending cue its duration
+    if (!vtt_cue_from_caption_frame(frame, vtt)) {
+        return LIBCAPTION_ERROR;
+    }
+
+    while (vtt->cue_head != vtt->cue_tail) {
+        if (LIBCAPTION_OK != vtt_writer_cue(&emitter->writer, vtt->cue_head)) {
+            status = LIBCAPTION_ERROR;
+        }
+
+        vtt_cue_free_head(vtt);
+    }
+
+    return LIBCAPTION_OK == status ? vtt_writer_flush(&emitter->writer) : status;
+}
+
+libcaption_stauts_t vtt_emitter_finish(vtt_emitter_t* emitter)
+{
+    vtt_t* vtt = emitter->vtt;
+    libcaption_stauts_t status = LIBCAPTION_OK;
+
+    while (vtt->cue_head) {
+        if (LIBCAPTION_OK != vtt_writer_cue(&emitter->writer, vtt->cue_head)) {
+            status = LIBCAPTION_ERROR;
+        }
+
+        vtt_cue_free_head(vtt);
+    }
+
+    return LIBCAPTION_OK == status ? vtt_writer_flush(&emitter->writer) : status;
+}
+
+static int vtt_index_compare(const void* a, const void* b)
+{
+    const vtt_index_entry_t* x = (const vtt_index_entry_t*)a;
+    const vtt_index_entry_t* y = (const vtt_index_entry_t*)b;
+
+    if (x->start != y->start) {
+        return x->start < y->start ? -1 : 1;
+    }
+
+    return x->order < y->order ? -1 : (x->order > y->order ? 1 : 0);
+}
+
+libcaption_stauts_t vtt_index_init(vtt_index_t* index, vtt_t* vtt)
+{
+    size_t i;
+    int sorted = 1;
+    vtt_block_t* cue;
+
+    memset(index, 0, sizeof(vtt_index_t));
+
+    for (cue = vtt->cue_head; cue; cue = cue->next) {
+        ++index->count;
+    }
+
+    if (0 == index->count) {
+        return LIBCAPTION_OK;
+    }
+
+    if (!(index->entries = (vtt_index_entry_t*)malloc(index->count * sizeof(vtt_index_entry_t)))) {
+        index->count = 0;
+        return LIBCAPTION_ERROR;
+    }
+
+    for (i = 0, cue = vtt->cue_head; cue; cue = cue->next, ++i) {
+        index->entries[i].start = cue->timestamp;
+        index->entries[i].end = cue->timestamp + cue->duration;
+        index->entries[i].order = i;
+        index->entries[i].cue = cue;
+        sorted = sorted && (0 == i || index->entries[i - 1].start <= cue->timestamp);
+    }
+
+    // Most files are already in order
+    if (!sorted) {
+        qsort(index->entries, index->count, sizeof(vtt_index_entry_t), vtt_index_compare);
+    }
+
+    for (i = 0; i < index->count; ++i) {
+        index->entries[i].max_end = index->entries[i].end;
+
+        if (0 < i && index->entries[i - 1].max_end > index->entries[i].max_end) {
+            index->entries[i].max_end = index->entries[i - 1].max_end;
+        }
+    }
+
+    return LIBCAPTION_OK;
+}
+
+void vtt_index_free(vtt_index_t* index)
+{
+    free(index->entries);
+    memset(index, 0, sizeof(vtt_index_t));
+}
+
+vtt_block_t* vtt_index_query(const vtt_index_t* index, double start, double end, vtt_index_iter_t* iter)
+{
+    size_t lo, hi, mid;
+
+    iter->index = index;
+    iter->start = start;
+
+    // last: first entry that starts at or after end, or after it for an instant
+    for (lo = 0, hi = index->count; lo < hi;) {
+        mid = lo + (hi - lo) / 2;
+
+        if (index->entries[mid].start < end || (start == end && index->entries[mid].start == end)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    iter->last = lo;
+
+    // pos: first entry where something has ended after start, nothing before it can overlap
+    for (lo = 0, hi = iter->last; lo < hi;) {
+        mid = lo + (hi - lo) / 2;
+
+        if (index->entries[mid].max_end > start) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+
+    iter->pos = lo;
+    return vtt_index_iter_next(iter);
+}
+
+vtt_block_t* vtt_index_iter_next(vtt_index_iter_t* iter)
+{
+    while (iter->pos < iter->last) {
+        const vtt_index_entry_t* entry = &iter->index->entries[iter->pos++];
+
+        if (entry->end > iter->start) {
+            return entry->cue;
+        }
+    }
+
+    return NULL;
+}
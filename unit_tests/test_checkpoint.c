@@ -0,0 +1,235 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "check.h"
+#include "caption.h"
+#include "mpeg.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CHUNK_SIZE 37
+#define MAX_CAPTIONS 64
+#define CAPTION_LENGTH (32 + CAPTION_FRAME_TEXT_BYTES)
+
+// Decoder state, mpeg_bitstream_t is too large for the stack
+typedef struct {
+    mpeg_bitstream_t mpegbs;
+    caption_frame_t frame;
+    dtvcc_packet_t dtvcc;
+    uint8_t dtvcc_pos;
+} decoder_t;
+
+typedef struct {
+    size_t count;
+    char text[MAX_CAPTIONS][CAPTION_LENGTH];
+} captions_t;
+
+static void decoder_init(decoder_t* decoder)
+{
+    mpeg_bitstream_init(&decoder->mpegbs);
+    caption_frame_init(&decoder->frame);
+    memset(&decoder->dtvcc, 0, sizeof(dtvcc_packet_t));
+    decoder->dtvcc_pos = 0;
+}
+
+// Annex B H.264 with a caption SEI and a filler slice per caption, some of them clears
+static size_t make_stream(uint8_t* data)
+{
+    int i;
+    sei_t sei;
+    size_t size = 0;
+    caption_frame_t frame;
+    char text[64];
+    static const uint8_t slice[] = { 0, 0, 1, 0x41, 0x9a, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77 };
+
+    for (i = 0; i < 40; ++i) {
+        if (7 == i % 8) {
+            sei_from_caption_clear(&sei);
+        } else {
+            caption_frame_init(&frame);
+            sprintf(text, "Caption %d\nsecond line %d", i, i * 7);
+            caption_frame_from_text(&frame, text);
+            sei_from_caption_frame(&sei, &frame);
+        }
+
+        memcpy(data + size, "\0\0\1", 3);
+        size += 3;
+        size += sei_render(&sei, data + size);
+        sei_free(&sei);
+
+        memcpy(data + size, slice, sizeof(slice));
+        size += sizeof(slice);
+    }
+
+    // A final start code so the last NAL is complete
+    memcpy(data + size, "\0\0\1\x09\xf0", 5);
+    return size + 5;
+}
+
+// Parses chunks [first, last) of the stream, recording every caption
+static void decode_chunks(decoder_t* decoder, const uint8_t* data, size_t size, size_t first, size_t last, captions_t* captions)
+{
+    size_t chunk, pos, end, bytes;
+
+    for (chunk = first; chunk < last && chunk * CHUNK_SIZE < size; ++chunk) {
+        pos = chunk * CHUNK_SIZE;
+        end = pos + CHUNK_SIZE < size ? pos + CHUNK_SIZE : size;
+        // Out of order presentation times go through the reorder queue
+        double dts = chunk * 0.033, cts = (chunk % 3) * 0.033;
+
+        while (pos < end) {
+            bytes = mpeg_bitstream_parse(&decoder->mpegbs, &decoder->frame, data + pos, end - pos, STREAM_TYPE_H264, dts, cts, &decoder->dtvcc, &decoder->dtvcc_pos);
+            pos += bytes;
+
+            CHECK(LIBCAPTION_ERROR != mpeg_bitstream_status(&decoder->mpegbs));
+
+            if (LIBCAPTION_READY == mpeg_bitstream_status(&decoder->mpegbs) && captions->count < MAX_CAPTIONS) {
+                char* out = captions->text[captions->count++];
+                out += sprintf(out, "%.3f ", decoder->frame.timestamp);
+                caption_frame_to_text(&decoder->frame, out);
+            }
+        }
+    }
+}
+
+static int same_captions(const captions_t* a, const captions_t* b)
+{
+    size_t i;
+
+    if (a->count != b->count) {
+        fprintf(stderr, "%u captions != %u captions\n", (unsigned)a->count, (unsigned)b->count);
+        return 0;
+    }
+
+    for (i = 0; i < a->count; ++i) {
+        if (0 != strcmp(a->text[i], b->text[i])) {
+            fprintf(stderr, "'%s' != '%s'\n", a->text[i], b->text[i]);
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+// Saving at any chunk, mid NAL included, and restoring into a fresh decoder must not change the output
+static void test_resume(decoder_t* decoder, const uint8_t* data, size_t size)
+{
+    size_t split, chunks = (size + CHUNK_SIZE - 1) / CHUNK_SIZE, saved, required;
+    captions_t *expected = calloc(1, sizeof(captions_t)), *resumed = calloc(1, sizeof(captions_t));
+    uint8_t* checkpoint;
+
+    decoder_init(decoder);
+    decode_chunks(decoder, data, size, 0, chunks, expected);
+    CHECK(32 < expected->count);
+
+    for (split = 0; split <= chunks && !failures; ++split) {
+        memset(resumed, 0, sizeof(captions_t));
+        decoder_init(decoder);
+        decode_chunks(decoder, data, size, 0, split, resumed);
+
+        required = mpeg_bitstream_save(&decoder->mpegbs, &decoder->frame, &decoder->dtvcc, &decoder->dtvcc_pos, NULL, 0);
+        checkpoint = malloc(required);
+        CHECK(0 == mpeg_bitstream_save(&decoder->mpegbs, &decoder->frame, &decoder->dtvcc, &decoder->dtvcc_pos, checkpoint, required - 1));
+        saved = mpeg_bitstream_save(&decoder->mpegbs, &decoder->frame, &decoder->dtvcc, &decoder->dtvcc_pos, checkpoint, required);
+        CHECK(required == saved);
+
+        // Scribble over the old state so nothing carries over by accident
+        memset(decoder, 0x5a, sizeof(decoder_t));
+        decoder_init(decoder);
+        CHECK(LIBCAPTION_OK == mpeg_bitstream_load(&decoder->mpegbs, &decoder->frame, &decoder->dtvcc, &decoder->dtvcc_pos, checkpoint, saved));
+        decode_chunks(decoder, data, size, split, chunks, resumed);
+        CHECK(same_captions(expected, resumed));
+        free(checkpoint);
+    }
+
+    free(expected);
+    free(resumed);
+}
+
+static libcaption_stauts_t load(decoder_t* decoder, const uint8_t* data, size_t size)
+{
+    decoder_init(decoder);
+    return mpeg_bitstream_load(&decoder->mpegbs, &decoder->frame, &decoder->dtvcc, &decoder->dtvcc_pos, data, size);
+}
+
+// Truncated and corrupted checkpoints must be rejected
+static void test_reject(decoder_t* decoder, const uint8_t* data, size_t size)
+{
+    size_t length, saved, required;
+    uint8_t *checkpoint, *copy;
+    captions_t* captions = calloc(1, sizeof(captions_t));
+
+    decoder_init(decoder);
+    decode_chunks(decoder, data, size, 0, 20, captions);
+    required = mpeg_bitstream_save(&decoder->mpegbs, &decoder->frame, &decoder->dtvcc, &decoder->dtvcc_pos, NULL, 0);
+    checkpoint = malloc(required);
+    copy = malloc(required + 16);
+    saved = mpeg_bitstream_save(&decoder->mpegbs, &decoder->frame, &decoder->dtvcc, &decoder->dtvcc_pos, checkpoint, required);
+    CHECK(CHECKPOINT_HEADER_SIZE < saved);
+    CHECK(LIBCAPTION_OK == load(decoder, checkpoint, saved));
+    CHECK(LIBCAPTION_ERROR == load(decoder, NULL, 0));
+
+    for (length = 0; length < saved; ++length) {
+        CHECK(LIBCAPTION_ERROR == load(decoder, checkpoint, length));
+    }
+
+    // Magic
+    memcpy(copy, checkpoint, saved);
+    copy[0] ^= 0x20;
+    CHECK(LIBCAPTION_ERROR == load(decoder, copy, saved));
+
+    // Version
+    memcpy(copy, checkpoint, saved);
+    copy[4] = CHECKPOINT_VERSION + 1;
+    CHECK(LIBCAPTION_ERROR == load(decoder, copy, saved));
+
+    // First section longer than the checkpoint
+    memcpy(copy, checkpoint, saved);
+    memset(copy + CHECKPOINT_HEADER_SIZE + 1, 0xff, 4);
+    CHECK(LIBCAPTION_ERROR == load(decoder, copy, saved));
+
+    // Unknown sections are skipped
+    memcpy(copy, checkpoint, saved - 1);
+    memcpy(copy + saved - 1, "\x7f\x03\0\0\0abc", 8);
+    copy[saved + 7] = checkpoint_section_end;
+    CHECK(LIBCAPTION_OK == load(decoder, copy, saved + 8));
+
+    free(copy);
+    free(checkpoint);
+    free(captions);
+}
+
+int main(int argc, char** argv)
+{
+    uint8_t* data = malloc(64 * 1024);
+    decoder_t* decoder = malloc(sizeof(decoder_t));
+    size_t size = make_stream(data);
+
+    test_resume(decoder, data, size);
+    test_reject(decoder, data, size);
+    free(decoder);
+    free(data);
+
+    return check_report();
+}
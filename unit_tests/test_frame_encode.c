@@ -0,0 +1,286 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "check.h"
+#include "caption.h"
+#include "cmdlist.h"
+#include "eia608.h"
+#include "mpeg.h"
+#include "rollup_encoder.h"
+#include <stdio.h>
+#include <string.h>
+
+static void decode(caption_frame_t* frame, uint16_t cc_data)
+{
+    caption_frame_decode(frame, cc_data, 0.0);
+}
+
+static void decode_text(caption_frame_t* frame, const utf8_char_t* text)
+{
+    for (; *text; text = utf8_char_next(text)) {
+        decode(frame, eia608_from_utf8_1(text, DEFAULT_CHANNEL));
+    }
+}
+
+static const utf8_char_t* cell(caption_frame_t* frame, int row, int col)
+{
+    return caption_frame_read_char(frame, row, col, 0, 0);
+}
+
+// Backspace and delete to end of row write EIA608_CHAR_NULL, which must clear the cell
+static void test_backspace(void)
+{
+    int c;
+    caption_frame_t frame;
+    utf8_char_t text[CAPTION_FRAME_TEXT_BYTES];
+
+    caption_frame_init(&frame);
+    decode(&frame, eia608_control_command(eia608_control_resume_direct_captioning, DEFAULT_CHANNEL));
+    decode(&frame, eia608_row_style_pramble(14, DEFAULT_CHANNEL, eia608_style_white, 0));
+    decode_text(&frame, "ABCDEF");
+    decode(&frame, eia608_control_command(eia608_control_backspace, DEFAULT_CHANNEL));
+    CHECK(0 == strcmp("E", cell(&frame, 14, 4)));
+    CHECK(0 == *cell(&frame, 14, 5));
+
+    // Back to column 2, then clear the rest of the row
+    decode(&frame, eia608_row_style_pramble(14, DEFAULT_CHANNEL, eia608_style_white, 0));
+    decode(&frame, eia608_tab(2, DEFAULT_CHANNEL));
+    decode(&frame, eia608_control_command(eia608_control_delete_to_end_of_row, DEFAULT_CHANNEL));
+    CHECK(0 == strcmp("B", cell(&frame, 14, 1)));
+
+    for (c = 2; c < SCREEN_COLS; ++c) {
+        CHECK(0 == *cell(&frame, 14, c));
+    }
+
+    caption_frame_to_text(&frame, text);
+    CHECK(0 == strcmp("AB", text));
+}
+
+// An indent preamble must land the cursor on its column, with a valid parity
+static void test_indented_popon(void)
+{
+    int c, underline;
+    eia608_style_t style;
+    caption_frame_t frame;
+    uint16_t preamble = eia608_row_column_pramble(2, 13, DEFAULT_CHANNEL, 0);
+
+    CHECK(eia608_parity_varify(preamble));
+
+    caption_frame_init(&frame);
+    decode(&frame, eia608_control_command(eia608_control_resume_caption_loading, DEFAULT_CHANNEL));
+    decode(&frame, preamble);
+    decode(&frame, eia608_tab(1, DEFAULT_CHANNEL));
+    decode_text(&frame, "Hi");
+    decode(&frame, eia608_control_command(eia608_control_end_of_caption, DEFAULT_CHANNEL));
+
+    for (c = 0; c < 13; ++c) {
+        CHECK(0 == *cell(&frame, 2, c));
+    }
+
+    CHECK(0 == strcmp("H", caption_frame_read_char(&frame, 2, 13, &style, &underline)));
+    CHECK(eia608_style_white == style && 0 == underline);
+    CHECK(0 == strcmp("i", cell(&frame, 2, 14)));
+
+    // Then clear the caption one cell at a time, as a live correction would
+    decode(&frame, eia608_control_command(eia608_control_resume_direct_captioning, DEFAULT_CHANNEL));
+    decode(&frame, eia608_row_column_pramble(2, 15, DEFAULT_CHANNEL, 0));
+    decode(&frame, eia608_tab(3, DEFAULT_CHANNEL));
+    decode(&frame, eia608_control_command(eia608_control_backspace, DEFAULT_CHANNEL));
+    CHECK(0 == strcmp("H", cell(&frame, 2, 13)));
+    CHECK(0 == *cell(&frame, 2, 14));
+}
+
+// A character waiting to be paired must keep the style it was written with
+static void test_sei_midrow_pairing(void)
+{
+    int underline;
+    eia608_style_t style;
+    sei_t sei;
+    caption_frame_t frame, decoded;
+    dtvcc_packet_t dtvcc;
+    uint8_t dtvcc_pos = 0;
+
+    caption_frame_init(&frame);
+    decode(&frame, eia608_control_command(eia608_control_resume_caption_loading, DEFAULT_CHANNEL));
+    decode(&frame, eia608_row_style_pramble(0, DEFAULT_CHANNEL, eia608_style_white, 0));
+    decode_text(&frame, "A");
+    decode(&frame, eia608_midrow_change(DEFAULT_CHANNEL, eia608_style_red, 0));
+    decode_text(&frame, "B");
+    decode(&frame, eia608_control_command(eia608_control_end_of_caption, DEFAULT_CHANNEL));
+
+    sei_from_caption_frame(&sei, &frame);
+    caption_frame_init(&decoded);
+    memset(&dtvcc, 0, sizeof(dtvcc_packet_t));
+    sei_to_caption_frame(&sei, &decoded, &dtvcc, &dtvcc_pos);
+    sei_free(&sei);
+
+    CHECK(0 == strcmp("A", caption_frame_read_char(&decoded, 0, 0, &style, &underline)));
+    CHECK(eia608_style_white == style);
+    CHECK(0 == strcmp("B", caption_frame_read_char(&decoded, 0, 1, &style, &underline)));
+    CHECK(eia608_style_red == style);
+}
+
+static uint32_t random_state = 1;
+
+static int random_int(int n)
+{
+    random_state = random_state * 1103515245 + 12345;
+    return (int)((random_state >> 16) % n);
+}
+
+// Paints random rows into the displayed memory of frame. Rows are blank, random, copied from base,
+// or copied from base with cells dropped and replaced, so the delta encoder sees gaps, restyled
+// cells and shortened rows
+static void random_frame(caption_frame_t* frame, caption_frame_t* base)
+{
+    static const char* chars[] = { "A", "b", "c", "1", " ", "\xc3\xa9", "\xc3\x89", "\xe2\x99\xaa" };
+    int r, c, mode, underline;
+    eia608_style_t style;
+    const utf8_char_t* data;
+
+    caption_frame_init(frame);
+    decode(frame, eia608_control_command(eia608_control_resume_direct_captioning, DEFAULT_CHANNEL));
+
+    for (r = 0; r < SCREEN_ROWS; ++r) {
+        mode = random_int(base ? 4 : 2);
+
+        for (c = 0; c < SCREEN_COLS; ++c) {
+            if (1 == mode && 0 == random_int(3)) {
+                caption_frame_write_char(frame, r, c, (eia608_style_t)random_int(8), random_int(2), chars[random_int(8)]);
+            } else if (2 == mode || (3 == mode && random_int(4))) {
+                data = caption_frame_read_char(base, r, c, &style, &underline);
+
+                if (*data) {
+                    caption_frame_write_char(frame, r, c, style, underline, data);
+                }
+            } else if (3 == mode && random_int(2)) {
+                caption_frame_write_char(frame, r, c, (eia608_style_t)random_int(8), random_int(2), chars[random_int(8)]);
+            }
+        }
+    }
+}
+
+static void decode_cmdlist(caption_frame_t* frame, cc_data_cmdlist_t* cmdlist)
+{
+    size_t i;
+
+    for (i = 0; i < cmdlist->length; ++i) {
+        decode(frame, cmdlist_peek(cmdlist, i)->cc_data);
+    }
+}
+
+static int same_display(caption_frame_t* a, caption_frame_t* b)
+{
+    int r, c, a_underline, b_underline;
+    eia608_style_t a_style, b_style;
+    const utf8_char_t *a_data, *b_data;
+
+    for (r = 0; r < SCREEN_ROWS; ++r) {
+        for (c = 0; c < SCREEN_COLS; ++c) {
+            a_data = caption_frame_read_char(a, r, c, &a_style, &a_underline);
+            b_data = caption_frame_read_char(b, r, c, &b_style, &b_underline);
+
+            if (0 != strcmp(a_data, b_data) || (*a_data && (a_style != b_style || a_underline != b_underline))) {
+                fprintf(stderr, "row %d col %d: '%s' %d %d != '%s' %d %d\n", r, c, a_data, a_style, a_underline, b_data, b_style, b_underline);
+                return 0;
+            }
+        }
+    }
+
+    return 1;
+}
+
+// Decoding the commands for prev, then the delta, must reproduce next
+static void test_delta_round_trip(void)
+{
+    int i;
+    caption_frame_t frames[2], decoded, blank;
+    cc_data_cmdlist_t cmdlist;
+
+    cmdlist_init(&cmdlist);
+    caption_frame_init(&decoded);
+    caption_frame_init(&blank);
+    random_frame(&frames[0], NULL);
+    cmdlist_append_frame_delta(&cmdlist, NULL, &frames[0]);
+    decode_cmdlist(&decoded, &cmdlist);
+    CHECK(same_display(&decoded, &frames[0]));
+
+    for (i = 1; i < 1000 && !failures; ++i) {
+        caption_frame_t* prev = &frames[(i - 1) % 2];
+        caption_frame_t* next = &frames[i % 2];
+
+        if (0 == i % 50) {
+            caption_frame_init(next);
+        } else {
+            random_frame(next, prev);
+        }
+
+        cmdlist_clear(&cmdlist);
+        CHECK(LIBCAPTION_OK == cmdlist_append_frame_delta(&cmdlist, prev, next));
+        decode_cmdlist(&decoded, &cmdlist);
+        CHECK(same_display(&decoded, next));
+    }
+
+    // Nothing is sent when nothing changed
+    cmdlist_clear(&cmdlist);
+    cmdlist_append_frame_delta(&cmdlist, &frames[0], &frames[0]);
+    CHECK(0 == cmdlist.length);
+    cmdlist_free(&cmdlist);
+}
+
+// Characters 608 can not carry take no room, so they must not wrap a word that fits
+static void test_rollup_unmappable(void)
+{
+    size_t i;
+    caption_frame_t frame;
+    rollup_encoder_t enc;
+    cc_data_cmdlist_t cmdlist;
+    utf8_char_t text[CAPTION_FRAME_TEXT_BYTES];
+
+    caption_frame_init(&frame);
+    cmdlist_init(&cmdlist);
+    rollup_encoder_init(&enc, 2, 14);
+    CHECK(LIBCAPTION_OK == rollup_encoder_append(&enc, &cmdlist,
+                               "aaaaaaaaaaaaaaaaaaaaaaaaaaaa b\xF0\x9F\x98\x80\xF0\x9F\x98\x80\xF0\x9F\x98\x80 \xF0\x9F\x98\x80 c"));
+    CHECK(LIBCAPTION_OK == rollup_encoder_flush(&enc, &cmdlist));
+    CHECK(SCREEN_COLS == enc.col);
+
+    for (i = 0; i < cmdlist.length; ++i) {
+        decode(&frame, cmdlist_peek(&cmdlist, i)->cc_data);
+    }
+
+    caption_frame_to_text(&frame, text);
+    CHECK(0 == strcmp("aaaaaaaaaaaaaaaaaaaaaaaaaaaa b c", text));
+    cmdlist_free(&cmdlist);
+}
+
+int main(int argc, char** argv)
+{
+    test_backspace();
+    test_indented_popon();
+    test_sei_midrow_pairing();
+    test_delta_round_trip();
+    test_rollup_unmappable();
+
+    return check_report();
+}
@@ -0,0 +1,140 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "check.h"
+#include "eia608.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WORDS 0x10000
+#define GUARD 0xA5A5
+#define MAX_OFFSET 8
+
+// words[first, first + count) copied to buffer + offset, which is rarely 16 byte aligned.
+// The words either side are guards that must not change
+static uint16_t* place(uint16_t* buffer, const uint16_t* words, size_t first, size_t count, size_t offset)
+{
+    size_t i;
+
+    for (i = 0; i < count + 2 * MAX_OFFSET; ++i) {
+        buffer[i] = GUARD;
+    }
+
+    memcpy(buffer + offset, words + first, count * sizeof(uint16_t));
+    return buffer + offset;
+}
+
+static void check_apply(uint16_t* buffer, const uint16_t* words, size_t first, size_t count, size_t offset)
+{
+    size_t i, bad = 0;
+    uint16_t* data = place(buffer, words, first, count, offset);
+
+    eia608_parity_apply_many(data, count);
+
+    for (i = 0; i < count; ++i) {
+        bad += data[i] != eia608_parity(words[first + i]);
+    }
+
+    for (i = 0; i < offset; ++i) {
+        bad += GUARD != buffer[i];
+    }
+
+    for (i = offset + count; i < count + 2 * MAX_OFFSET; ++i) {
+        bad += GUARD != buffer[i];
+    }
+
+    if (bad) {
+        fprintf(stderr, "apply: first %u count %u offset %u\n", (unsigned)first, (unsigned)count, (unsigned)offset);
+    }
+
+    CHECK(0 == bad);
+}
+
+static void check_varify(uint16_t* buffer, const uint16_t* words, size_t first, size_t count, size_t offset)
+{
+    size_t i, bad = 0, expected = 0, blocks = (count + 63) / 64;
+    uint16_t* data = place(buffer, words, first, count, offset);
+    uint64_t* failed = malloc((blocks + 1) * sizeof(uint64_t));
+
+    // The bitmap must be written exactly, unused bits cleared and the guard left alone
+    memset(failed, 0xff, (blocks + 1) * sizeof(uint64_t));
+    size_t total = eia608_parity_varify_many(data, count, failed);
+
+    for (i = 0; i < count; ++i) {
+        int fail = !eia608_parity_varify(words[first + i]);
+        expected += fail;
+        bad += fail != (int)((failed[i / 64] >> (i % 64)) & 1);
+    }
+
+    for (; i < 64 * blocks; ++i) {
+        bad += (failed[i / 64] >> (i % 64)) & 1;
+    }
+
+    bad += ~0ULL != failed[blocks];
+    bad += expected != total;
+    bad += total != eia608_parity_varify_many(data, count, NULL);
+
+    if (bad) {
+        fprintf(stderr, "varify: first %u count %u offset %u\n", (unsigned)first, (unsigned)count, (unsigned)offset);
+    }
+
+    CHECK(0 == bad);
+    free(failed);
+}
+
+int main(int argc, char** argv)
+{
+    size_t i, count, offset, first;
+    uint16_t* words = malloc(WORDS * sizeof(uint16_t));
+    uint16_t* correct = malloc(WORDS * sizeof(uint16_t));
+    uint16_t* buffer = malloc((WORDS + 2 * MAX_OFFSET) * sizeof(uint16_t));
+
+    // Every possible word, and every word with its parity set so verify sees all passing too
+    for (i = 0; i < WORDS; ++i) {
+        words[i] = (uint16_t)i;
+        correct[i] = eia608_parity((uint16_t)i);
+    }
+
+    for (offset = 0; offset < MAX_OFFSET; ++offset) {
+        check_apply(buffer, words, 0, WORDS, offset);
+        check_varify(buffer, words, 0, WORDS, offset);
+        check_varify(buffer, correct, 0, WORDS, offset);
+    }
+
+    // Lengths around the 4 and 8 word vectors and the 64 word bitmap blocks
+    for (count = 0; count <= 200; ++count) {
+        for (offset = 0; offset < MAX_OFFSET; ++offset) {
+            first = (count * 977 + offset * 131) % (WORDS - count);
+            check_apply(buffer, words, first, count, offset);
+            check_varify(buffer, words, first, count, offset);
+            check_varify(buffer, correct, first, count, offset);
+        }
+    }
+
+    free(buffer);
+    free(correct);
+    free(words);
+
+    return check_report();
+}
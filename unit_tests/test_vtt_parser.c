@@ -0,0 +1,173 @@
+/**********************************************************************************************/
+/* The MIT License                                                                            */
+/*                                                                                            */
+/* Copyright 2016-2017 Twitch Interactive, Inc. or its affiliates. All Rights Reserved.       */
+/*                                                                                            */
+/* Permission is hereby granted, free of charge, to any person obtaining a copy               */
+/* of this software and associated documentation files (the "Software"), to deal              */
+/* in the Software without restriction, including without limitation the rights               */
+/* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell                  */
+/* copies of the Software, and to permit persons to whom the Software is                      */
+/* furnished to do so, subject to the following conditions:                                   */
+/*                                                                                            */
+/* The above copyright notice and this permission notice shall be included in                 */
+/* all copies or substantial portions of the Software.                                        */
+/*                                                                                            */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR                 */
+/* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,                   */
+/* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE                */
+/* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER                     */
+/* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,              */
+/* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN                  */
+/* THE SOFTWARE.                                                                              */
+/**********************************************************************************************/
+#include "check.h"
+#include "srt.h"
+#include "vtt.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint32_t random_state = 1;
+
+static size_t random_size(size_t max)
+{
+    random_state = random_state * 1103515245 + 12345;
+    return 1 + (random_state >> 16) % max;
+}
+
+static int same_string(const char* a, const char* b)
+{
+    return (!a && !b) || (a && b && 0 == strcmp(a, b));
+}
+
+static int same_blocks(vtt_block_t* a, vtt_block_t* b)
+{
+    for (; a && b; a = a->next, b = b->next) {
+        if (a->type != b->type || a->timestamp != b->timestamp || a->duration != b->duration
+            || !same_string(vtt_block_data(a), vtt_block_data(b))
+            || !same_string(a->cue_id, b->cue_id) || !same_string(a->cue_settings, b->cue_settings)) {
+            fprintf(stderr, "'%s' != '%s'\n", vtt_block_data(a), vtt_block_data(b));
+            return 0;
+        }
+    }
+
+    return !a && !b;
+}
+
+// Pushes data up to split as one chunk, the rest in chunks of chunk bytes, or random sizes when chunk
+// is 0, then compares with the whole file parser
+static void check_push(const char* name, const utf8_char_t* data, size_t size, int srt_mode, vtt_t* expected, size_t split, size_t chunk)
+{
+    size_t pos, length;
+    libcaption_stauts_t status = LIBCAPTION_OK;
+    vtt_parser_t parser;
+    vtt_t* vtt = vtt_new();
+
+    vtt_parser_init(&parser, vtt, srt_mode);
+
+    for (pos = 0; pos < size; pos += length) {
+        if (pos < split) {
+            length = split - pos;
+        } else {
+            length = chunk ? chunk : random_size(64);
+        }
+
+        length = length < size - pos ? length : size - pos;
+        status = libcaption_status_update(status, vtt_parser_push(&parser, data + pos, length));
+    }
+
+    status = libcaption_status_update(status, vtt_parser_flush(&parser));
+
+    if (LIBCAPTION_ERROR == status || !same_blocks(expected->cue_head, vtt->cue_head)
+        || !same_blocks(expected->region_head, vtt->region_head) || !same_blocks(expected->style_head, vtt->style_head)) {
+        fprintf(stderr, "%s: split %u chunk %u\n", name, (unsigned)split, (unsigned)chunk);
+        CHECK(0);
+    }
+
+    vtt_parser_free(&parser);
+    vtt_free(vtt);
+}
+
+static void check_file(const char* name, const utf8_char_t* data, size_t size, int srt_mode)
+{
+    size_t i, chunk;
+    vtt_t* expected = srt_mode ? srt_parse(data, size) : vtt_parse(data, size);
+
+    CHECK(expected && expected->cue_head);
+
+    if (!expected) {
+        return;
+    }
+
+    check_push(name, data, size, srt_mode, expected, size, 0);
+
+    for (chunk = 1; chunk <= 3; ++chunk) {
+        check_push(name, data, size, srt_mode, expected, 0, chunk);
+    }
+
+    for (i = 0; i < 20; ++i) {
+        check_push(name, data, size, srt_mode, expected, 0, 0);
+    }
+
+    // A chunk boundary between every \r and \n
+    for (i = 0; i < size; ++i) {
+        if ('\r' == data[i]) {
+            check_push(name, data, size, srt_mode, expected, i + 1, size);
+        }
+    }
+
+    vtt_free(expected);
+}
+
+// Converts line endings to \r\n
+static utf8_char_t* crlf(const utf8_char_t* data, size_t size, size_t* out_size)
+{
+    size_t i;
+    utf8_char_t* out = malloc(2 * size + 1);
+
+    for (i = 0, (*out_size) = 0; i < size; ++i) {
+        if ('\n' == data[i] && (0 == i || '\r' != data[i - 1])) {
+            out[(*out_size)++] = '\r';
+        }
+
+        out[(*out_size)++] = data[i];
+    }
+
+    out[*out_size] = 0;
+    return out;
+}
+
+int main(int argc, char** argv)
+{
+    int i;
+    char path[1024];
+    size_t size, crlf_size;
+    utf8_char_t *data, *crlf_data;
+    static const char* files[] = { "example1.vtt", "example2.vtt", "example3.vtt", "example4.vtt", "example5.vtt", "example6.vtt", "example1.srt" };
+
+    if (2 != argc) {
+        fprintf(stderr, "Usage: %s sample_files_directory\n", argv[0]);
+        return 1;
+    }
+
+    for (i = 0; i < (int)(sizeof(files) / sizeof(files[0])); ++i) {
+        int srt_mode = NULL != strstr(files[i], ".srt");
+        snprintf(path, sizeof(path), "%s/%s", argv[1], files[i]);
+        size = 0;
+
+        if (!(data = utf8_load_text_file(path, &size))) {
+            fprintf(stderr, "Failed to load %s\n", path);
+            CHECK(0);
+            continue;
+        }
+
+        check_file(files[i], data, size, srt_mode);
+        crlf_data = crlf(data, size, &crlf_size);
+        check_file(files[i], crlf_data, crlf_size, srt_mode);
+        free(crlf_data);
+        free(data);
+    }
+
+    return check_report();
+}